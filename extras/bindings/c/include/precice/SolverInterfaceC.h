@@ -80,6 +80,20 @@ double precicec_advance(double computedTimestepLength);
  */
 void precicec_finalize();
 
+/**
+ * @brief Writes the coupling state of this rank required for a warm restart.
+ *
+ * @param[in] filenamePrefix Prefix of the binary checkpoint files.
+ */
+void precicec_writeCheckpoint(const char *filenamePrefix);
+
+/**
+ * @brief Restores the coupling state written by precicec_writeCheckpoint().
+ *
+ * @param[in] filenamePrefix Prefix of the binary checkpoint files.
+ */
+void precicec_readCheckpoint(const char *filenamePrefix);
+
 ///@}
 
 ///@name Status Queries
@@ -271,6 +285,18 @@ void precicec_setMeshTriangleWithEdges(
     int secondVertexID,
     int thirdVertexID);
 
+/**
+ * @brief Sets multiple triangles from vertex IDs. Creates missing edges.
+ *
+ * @param[in] meshID ID of the mesh to add the triangles to
+ * @param[in] size Number of triangles to create
+ * @param[in] vertexIDs IDs of the vertices forming the triangles, 3 per triangle
+ */
+void precicec_setMeshTriangles(
+    int        meshID,
+    int        size,
+    const int *vertexIDs);
+
 /**
  * @brief Sets mesh Quad from edge IDs.
  *
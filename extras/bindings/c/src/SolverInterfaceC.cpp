@@ -81,6 +81,20 @@ void precicec_finalize()
   impl.reset();
 }
 
+void precicec_writeCheckpoint(const char *filenamePrefix)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  PRECICE_ASSERT(filenamePrefix != nullptr);
+  impl->writeCheckpoint(std::string(filenamePrefix));
+}
+
+void precicec_readCheckpoint(const char *filenamePrefix)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  PRECICE_ASSERT(filenamePrefix != nullptr);
+  impl->readCheckpoint(std::string(filenamePrefix));
+}
+
 int precicec_getDimensions()
 {
   PRECICE_CHECK(impl != nullptr, errormsg);
@@ -272,6 +286,15 @@ void precicec_setMeshTriangleWithEdges(
   impl->setMeshTriangleWithEdges(meshID, firstVertexID, secondVertexID, thirdVertexID);
 }
 
+void precicec_setMeshTriangles(
+    int        meshID,
+    int        size,
+    const int *vertexIDs)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshTriangles(meshID, size, vertexIDs);
+}
+
 void precicec_setMeshQuad(
     int meshID,
     int firstEdgeID,
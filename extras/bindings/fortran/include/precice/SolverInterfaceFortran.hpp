@@ -80,6 +80,34 @@ void precicef_advance_(double *timestepLengthLimit);
  */
 void precicef_finalize_();
 
+/**
+ * Fortran syntax:
+ * precicef_write_checkpoint( CHARACTER filenamePrefix(*) )
+ *
+ * IN:  filenamePrefix
+ * OUT: -
+ *
+ * @copydoc precice::SolverInterface::writeCheckpoint()
+ *
+ */
+void precicef_write_checkpoint_(
+    const char *filenamePrefix,
+    int         lengthFilenamePrefix);
+
+/**
+ * Fortran syntax:
+ * precicef_read_checkpoint( CHARACTER filenamePrefix(*) )
+ *
+ * IN:  filenamePrefix
+ * OUT: -
+ *
+ * @copydoc precice::SolverInterface::readCheckpoint()
+ *
+ */
+void precicef_read_checkpoint_(
+    const char *filenamePrefix,
+    int         lengthFilenamePrefix);
+
 /**
  * Fortran syntax:
  * precicef_get_dims( INTEGER dimensions )
@@ -512,6 +540,24 @@ void precicef_set_triangle_we_(
     const int *secondVertexID,
     const int *thirdVertexID);
 
+/**
+ * Fortran syntax:
+ * precicef_set_triangles(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(3*size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: -
+ *
+ * @copydoc precice::SolverInterface::setMeshTriangles()
+ *
+ */
+void precicef_set_triangles_(
+    const int *meshID,
+    const int *size,
+    const int *vertexIDs);
+
 /**
  * Fortran syntax:
  * precicef_set_quad(
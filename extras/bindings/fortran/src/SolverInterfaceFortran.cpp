@@ -85,6 +85,26 @@ void precicef_finalize_()
   impl.reset();
 }
 
+void precicef_write_checkpoint_(
+    const char *filenamePrefix,
+    int         lengthFilenamePrefix)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  int    strippedLength = precice::impl::strippedLength(filenamePrefix, lengthFilenamePrefix);
+  string stringFilenamePrefix(filenamePrefix, strippedLength);
+  impl->writeCheckpoint(stringFilenamePrefix);
+}
+
+void precicef_read_checkpoint_(
+    const char *filenamePrefix,
+    int         lengthFilenamePrefix)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  int    strippedLength = precice::impl::strippedLength(filenamePrefix, lengthFilenamePrefix);
+  string stringFilenamePrefix(filenamePrefix, strippedLength);
+  impl->readCheckpoint(stringFilenamePrefix);
+}
+
 void precicef_get_dims_(
     int *dimensions)
 {
@@ -363,6 +383,15 @@ void precicef_set_triangle_we_(
   impl->setMeshTriangleWithEdges(*meshID, *firstVertexID, *secondVertexID, *thirdVertexID);
 }
 
+void precicef_set_triangles_(
+    const int *meshID,
+    const int *size,
+    const int *vertexIDs)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshTriangles(*meshID, *size, vertexIDs);
+}
+
 void precicef_set_quad_(
     const int *meshID,
     const int *firstEdgeID,
@@ -0,0 +1,125 @@
+#include <mpi.h>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "com/Communication.hpp"
+#include "com/MPIPortsCommunication.hpp"
+#include "com/SocketCommunication.hpp"
+#include "logging/LogConfiguration.hpp"
+
+using namespace precice;
+
+namespace {
+
+com::PtrCommunication createCommunication(const std::string &type)
+{
+  if (type == "mpi") {
+    return std::make_shared<com::MPIPortsCommunication>();
+  }
+  return std::make_shared<com::SocketCommunication>();
+}
+
+/// Runs the operation the given number of times and returns the maximal average time per call in microseconds
+template <typename Operation>
+double measure(int iterations, Operation &&operation)
+{
+  // Warm up the connections
+  operation();
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  const double start = MPI_Wtime();
+  for (int i = 0; i < iterations; ++i) {
+    operation();
+  }
+  const double local = (MPI_Wtime() - start) / iterations * 1e6;
+
+  double maximum = 0.0;
+  MPI_Allreduce(&local, &maximum, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  return maximum;
+}
+
+void benchmark(const std::string &type, bool useTree, int iterations, int vectorSize, int rank, int size)
+{
+  auto com = createCommunication(type);
+  com->setUseCollectiveTree(useTree);
+  com->connectMasterSlaves(useTree ? "BenchmarkTree" : "BenchmarkStar", "", rank, size);
+
+  const bool          isMaster = (rank == 0);
+  double              scalar   = 0.0;
+  std::vector<double> send(vectorSize, rank + 1.0);
+  std::vector<double> receive(vectorSize, 0.0);
+
+  const double allreduceScalar = measure(iterations, [&] {
+    if (isMaster) {
+      com->allreduceSum(1.0, scalar);
+    } else {
+      com->allreduceSum(1.0, scalar, 0);
+    }
+  });
+  const double allreduceVector = measure(iterations, [&] {
+    if (isMaster) {
+      com->allreduceSum(send, receive);
+    } else {
+      com->allreduceSum(send, receive, 0);
+    }
+  });
+  const double broadcastVector = measure(iterations, [&] {
+    if (isMaster) {
+      com->broadcast(precice::span<const double>{send});
+    } else {
+      com->broadcast(precice::span<double>{receive}, 0);
+    }
+  });
+
+  if (isMaster) {
+    std::cout << std::setw(6) << size << std::setw(8) << (com->hasCollectiveTree() ? "tree" : "star")
+              << std::fixed << std::setprecision(1)
+              << std::setw(22) << allreduceScalar
+              << std::setw(22) << allreduceVector
+              << std::setw(22) << broadcastVector << std::endl;
+  }
+  com->closeConnection();
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  MPI_Init(&argc, &argv);
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  const std::string type       = argc > 1 ? argv[1] : "sockets";
+  const int         iterations = argc > 2 ? std::stoi(argv[2]) : 1000;
+  const int         vectorSize = argc > 3 ? std::stoi(argv[3]) : 100;
+
+  logging::setupLogging(logging::LoggingConfiguration{}, false);
+
+  if (size < 2) {
+    if (rank == 0) {
+      std::cerr << "The benchmark requires at least 2 ranks." << std::endl;
+    }
+    MPI_Finalize();
+    return 1;
+  }
+
+  if (rank == 0) {
+    std::cout << "# " << type << ", " << iterations << " iterations, vectors of size " << vectorSize << ", times in us\n"
+              << std::setw(6) << "ranks" << std::setw(8) << "mode"
+              << std::setw(22) << "allreduce(double)"
+              << std::setw(22) << "allreduce(vector)"
+              << std::setw(22) << "broadcast(vector)" << std::endl;
+  }
+
+  benchmark(type, false, iterations, vectorSize, rank, size);
+  benchmark(type, true, iterations, vectorSize, rank, size);
+
+  MPI_Finalize();
+  return 0;
+}
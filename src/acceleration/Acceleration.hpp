@@ -9,8 +9,8 @@
 
 namespace precice {
 namespace io {
-class TXTWriter;
-class TXTReader;
+class BinaryWriter;
+class BinaryReader;
 } // namespace io
 } // namespace precice
 
@@ -39,9 +39,11 @@ public:
 
   virtual void iterationsConverged(DataMap &cpldata) = 0;
 
-  virtual void exportState(io::TXTWriter &writer) {}
+  /// Writes the state required to continue the acceleration after a restart.
+  virtual void exportState(io::BinaryWriter &writer) const {}
 
-  virtual void importState(io::TXTReader &reader) {}
+  /// Restores the state written by exportState(), has to be called after initialize().
+  virtual void importState(io::BinaryReader &reader) {}
 
   /// Gives the number of QN columns that where filtered out (i.e. deleted) in this time window
   virtual int getDeletedColumns() const
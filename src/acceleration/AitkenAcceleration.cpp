@@ -9,6 +9,8 @@
 #include <utility>
 
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "math/math.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -109,5 +111,21 @@ void AitkenAcceleration::iterationsConverged(
   _residuals        = Eigen::VectorXd::Constant(_residuals.size(), std::numeric_limits<double>::max());
 }
 
+void AitkenAcceleration::exportState(
+    io::BinaryWriter &writer) const
+{
+  writer.write(_aitkenFactor);
+  writer.write(_iterationCounter);
+  writer.write(_residuals);
+}
+
+void AitkenAcceleration::importState(
+    io::BinaryReader &reader)
+{
+  reader.read(_aitkenFactor);
+  reader.read(_iterationCounter);
+  reader.read(_residuals);
+}
+
 } // namespace acceleration
 } // namespace precice
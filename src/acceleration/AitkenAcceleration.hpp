@@ -33,6 +33,10 @@ public:
   virtual void iterationsConverged(
       DataMap &cpldata);
 
+  virtual void exportState(io::BinaryWriter &writer) const;
+
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   logging::Logger _log{"acceleration::AitkenAcceleration"};
 
@@ -9,6 +9,8 @@
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -19,11 +21,6 @@
 #include "utils/assertion.hpp"
 
 namespace precice {
-namespace io {
-class TXTReader;
-class TXTWriter;
-} // namespace io
-
 extern bool syncMode;
 namespace acceleration {
 
@@ -290,6 +287,7 @@ void BaseQNAcceleration::performAcceleration(
   PRECICE_TRACE(_dataIDs.size(), cplData.size());
 
   utils::Event e("cpl.computeQuasiNewtonUpdate", precice::syncMode);
+  const int     reductions = _qrV.getReductionCount();
 
   PRECICE_ASSERT(_oldResiduals.size() == _oldXTilde.size(), _oldResiduals.size(), _oldXTilde.size());
   PRECICE_ASSERT(_values.size() == _oldXTilde.size(), _values.size(), _oldXTilde.size());
@@ -436,6 +434,7 @@ void BaseQNAcceleration::performAcceleration(
   // number of iterations (usually equals number of columns in LS-system)
   its++;
   _firstIteration = false;
+  e.addData("qrGlobalReductions", _qrV.getReductionCount() - reductions);
 }
 
 void BaseQNAcceleration::applyFilter()
@@ -621,13 +620,54 @@ void BaseQNAcceleration::removeMatrixColumn(
 }
 
 void BaseQNAcceleration::exportState(
-    io::TXTWriter &writer)
+    io::BinaryWriter &writer) const
 {
+  writer.write(its);
+  writer.write(tWindows);
+  writer.write(_firstIteration);
+  writer.write(_firstTimeWindow);
+  writer.write(_resetLS);
+  writer.write(_oldXTilde);
+  writer.write(_oldResiduals);
+  writer.write(_matrixV);
+  writer.write(_matrixW);
+  writer.write(std::vector<int>(_matrixCols.begin(), _matrixCols.end()));
+  writer.write(_matrixVBackup);
+  writer.write(_matrixWBackup);
+  writer.write(std::vector<int>(_matrixColsBackup.begin(), _matrixColsBackup.end()));
+  _qrV.exportState(writer);
+  _preconditioner->exportState(writer);
 }
 
 void BaseQNAcceleration::importState(
-    io::TXTReader &reader)
+    io::BinaryReader &reader)
 {
+  PRECICE_TRACE();
+  PRECICE_ASSERT(_oldXTilde.size() == _residuals.size(), "The acceleration has to be initialized before importing a state.");
+  const auto rows = _residuals.size();
+
+  reader.read(its);
+  reader.read(tWindows);
+  reader.read(_firstIteration);
+  reader.read(_firstTimeWindow);
+  reader.read(_resetLS);
+  reader.read(_oldXTilde);
+  reader.read(_oldResiduals);
+  reader.read(_matrixV);
+  reader.read(_matrixW);
+  std::vector<int> cols;
+  reader.read(cols);
+  _matrixCols.assign(cols.begin(), cols.end());
+  reader.read(_matrixVBackup);
+  reader.read(_matrixWBackup);
+  reader.read(cols);
+  _matrixColsBackup.assign(cols.begin(), cols.end());
+  PRECICE_CHECK(_oldXTilde.size() == rows && _matrixV.rows() == _matrixW.rows() && (_matrixV.cols() == 0 || _matrixV.rows() == rows),
+                "The acceleration state in the checkpoint holds {} values on this rank, but the coupling data holds {}. "
+                "A checkpoint can only be read with the same partition of the coupling meshes.",
+                _oldXTilde.size(), rows);
+  _qrV.importState(reader);
+  _preconditioner->importState(reader);
 }
 
 int BaseQNAcceleration::getDeletedColumns() const
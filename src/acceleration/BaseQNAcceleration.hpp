@@ -50,8 +50,8 @@
 
 namespace precice {
 namespace io {
-class TXTReader;
-class TXTWriter;
+class BinaryReader;
+class BinaryWriter;
 } // namespace io
 
 namespace acceleration {
@@ -93,6 +93,14 @@ public:
     return _dataIDs;
   }
 
+  /**
+    * @brief Sets the variant of the Gram-Schmidt process used to update the QR-decomposition of V.
+    */
+  void setOrthogonalization(impl::QRFactorization::Orthogonalization orthogonalization)
+  {
+    _qrV.setOrthogonalization(orthogonalization);
+  }
+
   /**
     * @brief Initializes the acceleration.
     */
@@ -115,15 +123,18 @@ public:
 
   /**
     * @brief Exports the current state of the acceleration to a file.
+    *
+    * Writes the least-squares system with its QR-decomposition and the preconditioner weights
+    * of this rank, such that a restarted run continues with the same quasi-Newton updates.
     */
-  virtual void exportState(io::TXTWriter &writer);
+  virtual void exportState(io::BinaryWriter &writer) const;
 
   /**
     * @brief Imports the last exported state of the acceleration from file.
     *
-    * Is empty at the moment!!!
+    * Requires an initialized acceleration with the same partition of the coupling data.
     */
-  virtual void importState(io::TXTReader &reader);
+  virtual void importState(io::BinaryReader &reader);
 
   /// how many QN columns were deleted in this time window
   virtual int getDeletedColumns() const;
@@ -12,6 +12,8 @@
 #include "com/SharedPointer.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Helpers.hpp"
@@ -277,5 +279,35 @@ void IQNILSAcceleration::removeMatrixColumn(
 
   BaseQNAcceleration::removeMatrixColumn(columnIndex);
 }
+
+void IQNILSAcceleration::exportState(
+    io::BinaryWriter &writer) const
+{
+  BaseQNAcceleration::exportState(writer);
+  for (const auto *matrices : {&_secondaryMatricesW, &_secondaryMatricesWBackup}) {
+    writer.write(static_cast<int>(matrices->size()));
+    for (const auto &idAndMatrix : *matrices) {
+      writer.write(idAndMatrix.first);
+      writer.write(idAndMatrix.second);
+    }
+  }
+}
+
+void IQNILSAcceleration::importState(
+    io::BinaryReader &reader)
+{
+  BaseQNAcceleration::importState(reader);
+  for (auto *matrices : {&_secondaryMatricesW, &_secondaryMatricesWBackup}) {
+    int size = 0;
+    reader.read(size);
+    for (int i = 0; i < size; i++) {
+      int id = -1;
+      reader.read(id);
+      PRECICE_CHECK(utils::contained(id, _secondaryDataIDs),
+                    "The checkpoint holds secondary data with ID {}, which is not part of this acceleration.", id);
+      reader.read((*matrices)[id]);
+    }
+  }
+}
 } // namespace acceleration
 } // namespace precice
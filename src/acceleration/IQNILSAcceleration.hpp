@@ -48,6 +48,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the state of the base class and the difference matrices of the secondary data.
+  virtual void exportState(io::BinaryWriter &writer) const;
+
+  /// Imports the state written by exportState().
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /// Secondary data solver output from last iteration.
   std::map<int, Eigen::VectorXd> _secondaryOldXTildes;
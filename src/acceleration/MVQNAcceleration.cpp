@@ -16,6 +16,8 @@
 #include "com/MPIPortsCommunication.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "precice/types.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -110,7 +112,7 @@ void MVQNAcceleration::initialize(
   _Wtil = Eigen::MatrixXd::Zero(entries, 0);
 
   if (utils::MasterSlave::isMaster() || !utils::MasterSlave::isParallel()) {
-    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimeWindows << "\n--------\n"
+    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n max rank: " << _svdJ.getMaxRank() << "\n R_RS: " << _RSLSreusedTimeWindows << "\n--------\n"
                       << '\n';
   }
 }
@@ -753,7 +755,10 @@ void MVQNAcceleration::specializedIterationsConverged(
       /**
        *  Restart the IMVJ according to restart type
        */
-      if (static_cast<int>(_WtilChunk.size()) >= _chunkSize + 1) {
+      // compress the factors if the chunk is full or if they exceed the rank bound of RS-SVD
+      const bool chunkFull   = static_cast<int>(_WtilChunk.size()) >= _chunkSize + 1;
+      const bool rankTooHigh = _imvjRestartType == RS_SVD && _svdJ.getMaxRank() > 0 && storedRank() > _svdJ.getMaxRank();
+      if (chunkFull || rankTooHigh) {
 
         // < RESTART >
         _nbRestarts++;
@@ -784,6 +789,98 @@ void MVQNAcceleration::specializedIterationsConverged(
     // store inverse Jacobian from converged time window. NOT SCALED with preconditioner
     _oldInvJacobian = _invJacobian;
   }
+
+  // report the memory of the inverse Jacobian on this rank
+  utils::Event jacobianMemory("cpl.imvj.jacobianMemory");
+  jacobianMemory.addData("bytes", static_cast<long long>(getJacobianMemory()));
+  jacobianMemory.addData("storedRank", storedRank());
+  jacobianMemory.stop();
+  PRECICE_DEBUG("Inverse Jacobian uses {} bytes on this rank, stored rank: {}", getJacobianMemory(), storedRank());
+}
+
+// ==================================================================================
+void MVQNAcceleration::setMaxRank(
+    int maxRank)
+{
+  PRECICE_ASSERT(maxRank >= 0, maxRank);
+  _svdJ.setMaxRank(maxRank);
+}
+
+// ==================================================================================
+std::size_t MVQNAcceleration::getJacobianMemory() const
+{
+  std::size_t entries = _invJacobian.size() + _oldInvJacobian.size();
+  for (const auto &Wtil : _WtilChunk) {
+    entries += Wtil.size();
+  }
+  for (const auto &Z : _pseudoInverseChunk) {
+    entries += Z.size();
+  }
+  entries += _svdJ.storedEntries();
+  return entries * sizeof(double);
+}
+
+// ==================================================================================
+void MVQNAcceleration::exportState(
+    io::BinaryWriter &writer) const
+{
+  BaseQNAcceleration::exportState(writer);
+  writer.write(_invJacobian);
+  writer.write(_oldInvJacobian);
+  writer.write(_Wtil);
+  PRECICE_ASSERT(_WtilChunk.size() == _pseudoInverseChunk.size(), _WtilChunk.size(), _pseudoInverseChunk.size());
+  writer.write(static_cast<int>(_WtilChunk.size()));
+  for (std::size_t i = 0; i < _WtilChunk.size(); i++) {
+    writer.write(_WtilChunk[i]);
+    writer.write(_pseudoInverseChunk[i]);
+  }
+  writer.write(_matrixV_RSLS);
+  writer.write(_matrixW_RSLS);
+  writer.write(std::vector<int>(_matrixCols_RSLS.begin(), _matrixCols_RSLS.end()));
+  writer.write(_nbRestarts);
+  writer.write(_avgRank);
+  _svdJ.exportState(writer);
+}
+
+// ==================================================================================
+void MVQNAcceleration::importState(
+    io::BinaryReader &reader)
+{
+  PRECICE_TRACE();
+  BaseQNAcceleration::importState(reader);
+  reader.read(_invJacobian);
+  reader.read(_oldInvJacobian);
+  reader.read(_Wtil);
+  int chunks = 0;
+  reader.read(chunks);
+  _WtilChunk.resize(chunks);
+  _pseudoInverseChunk.resize(chunks);
+  for (int i = 0; i < chunks; i++) {
+    reader.read(_WtilChunk[i]);
+    reader.read(_pseudoInverseChunk[i]);
+  }
+  reader.read(_matrixV_RSLS);
+  reader.read(_matrixW_RSLS);
+  std::vector<int> cols;
+  reader.read(cols);
+  _matrixCols_RSLS.assign(cols.begin(), cols.end());
+  reader.read(_nbRestarts);
+  reader.read(_avgRank);
+  _svdJ.importState(reader);
+  PRECICE_CHECK(_imvjRestart || _oldInvJacobian.cols() == _residuals.size(),
+                "The inverse Jacobian in the checkpoint holds {} columns on this rank, but the coupling data holds {} values. "
+                "A checkpoint can only be read with the same partition of the coupling meshes.",
+                _oldInvJacobian.cols(), _residuals.size());
+}
+
+// ==================================================================================
+int MVQNAcceleration::storedRank() const
+{
+  int rank = 0;
+  for (const auto &Z : _pseudoInverseChunk) {
+    rank += Z.rows();
+  }
+  return rank;
 }
 
 // ==================================================================================
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstddef>
 #include <deque>
 #include <vector>
 #include "acceleration/Acceleration.hpp"
@@ -74,6 +75,26 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /** @brief Bounds the rank of the low-rank representation of the inverse Jacobian in restart-mode RS-SVD.
+   *
+   *  As soon as the stored chunks Wtil^q, Z^q hold more than maxRank columns in total, they are
+   *  compressed into the truncated SVD, which keeps at most maxRank modes. Hence, the memory per rank
+   *  is bounded by 2 * maxRank * n_local entries and the quasi-Newton update costs O(n * maxRank).
+   *  A value of 0 disables the bound, i.e., compression only takes place after #_chunkSize time windows.
+   */
+  void setMaxRank(int maxRank);
+
+  /// @brief Returns the number of bytes used on this rank to store the inverse Jacobian or its low-rank factors.
+  std::size_t getJacobianMemory() const;
+
+  /** @brief Exports the state of the base class and the approximation of the inverse Jacobian,
+   *  i.e., its explicit rows on this rank or the chunks Wtil^q, Z^q and the truncated SVD in restart-mode.
+   */
+  virtual void exportState(io::BinaryWriter &writer) const;
+
+  /// @brief Imports the state written by exportState().
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /// @brief stores the approximation of the inverse Jacobian of the system at current time window.
   Eigen::MatrixXd _invJacobian;
@@ -183,6 +204,9 @@ private:
     */
   void buildWtil();
 
+  /// @brief: returns the total number of columns of the stored factors Wtil^q, i.e., the rank of J_prev in restart-mode
+  int storedRank() const;
+
   /** @brief: restarts the imvj method, i.e., drops all stored matrices Wtil and Z and computes a
     *  initial guess of the Jacobian based on the given restart strategy:
     *  RS-LS:   Perform a IQN-LS least squares initial guess with _RSLSreusedTimeWindows
@@ -42,6 +42,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       TAG_ESTIMATEJACOBIAN("estimate-jacobian"),
       TAG_PRECONDITIONER("preconditioner"),
       TAG_IMVJRESTART("imvj-restart-mode"),
+      TAG_ORTHOGONALIZATION("orthogonalization"),
       ATTR_NAME("name"),
       ATTR_MESH("mesh"),
       ATTR_SCALING("scaling"),
@@ -53,6 +54,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       ATTR_IMVJCHUNKSIZE("chunk-size"),
       ATTR_RSLS_REUSED_TIME_WINDOWS("reused-time-windows-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
+      ATTR_RSSVD_MAXRANK("max-rank"),
       ATTR_PRECOND_NONCONST_TIME_WINDOWS("freeze-after"),
       VALUE_CONSTANT("constant"),
       VALUE_AITKEN("aitken"),
@@ -71,6 +73,8 @@ AccelerationConfiguration::AccelerationConfiguration(
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
       VALUE_NO_RESTART("no-restart"),
+      VALUE_GRAM_SCHMIDT("gram-schmidt"),
+      VALUE_CGS2("CGS2"),
       _meshConfig(meshConfig),
       _acceleration(),
       _neededMeshes(),
@@ -201,6 +205,14 @@ void AccelerationConfiguration::xmlTagCallback(
       PRECICE_ASSERT(false);
     }
     _config.singularityLimit = callingTag.getDoubleAttributeValue(ATTR_SINGULARITYLIMIT);
+  } else if (callingTag.getName() == TAG_ORTHOGONALIZATION) {
+    const auto &f = callingTag.getStringAttributeValue(ATTR_TYPE);
+    if (f == VALUE_CGS2) {
+      _config.orthogonalization = QRFactorization::Orthogonalization::CGS2;
+    } else {
+      PRECICE_ASSERT(f == VALUE_GRAM_SCHMIDT);
+      _config.orthogonalization = QRFactorization::Orthogonalization::GRAM_SCHMIDT;
+    }
   } else if (callingTag.getName() == TAG_PRECONDITIONER) {
     _config.preconditionerType         = callingTag.getStringAttributeValue(ATTR_TYPE);
     _config.precond_nbNonConstTWindows = callingTag.getIntAttributeValue(ATTR_PRECOND_NONCONST_TIME_WINDOWS);
@@ -222,7 +234,10 @@ void AccelerationConfiguration::xmlTagCallback(
       _config.imvjRestartType            = MVQNAcceleration::RS_LS;
     } else if (f == VALUE_SVD_RESTART) {
       _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRSSVD_maxRank       = callingTag.getIntAttributeValue(ATTR_RSSVD_MAXRANK);
       _config.imvjRestartType         = MVQNAcceleration::RS_SVD;
+      PRECICE_CHECK(_config.imvjRSSVD_maxRank >= 0,
+                    "The max-rank of the IMVJ restart-mode RS-SVD has to be zero (unbounded) or positive, but is {}.", _config.imvjRSSVD_maxRank);
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = MVQNAcceleration::RS_SLIDE;
     } else {
@@ -281,31 +296,34 @@ void AccelerationConfiguration::xmlEndTagCallback(
           new AitkenAcceleration(
               _config.relaxationFactor, _config.dataIDs));
     } else if (callingTag.getName() == VALUE_IQNILS) {
-      _acceleration = PtrAcceleration(
-          new IQNILSAcceleration(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timeWindowsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner));
+      auto iqnils = std::make_shared<IQNILSAcceleration>(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timeWindowsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner);
+      iqnils->setOrthogonalization(_config.orthogonalization);
+      _acceleration = iqnils;
     } else if (callingTag.getName() == VALUE_MVQN) {
 #ifndef PRECICE_NO_MPI
-      _acceleration = PtrAcceleration(
-          new MVQNAcceleration(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timeWindowsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner,
-              _config.alwaysBuildJacobian,
-              _config.imvjRestartType,
-              _config.imvjChunkSize,
-              _config.imvjRSLS_reusedTimeWindows,
-              _config.imvjRSSVD_truncationEps));
+      auto imvj = std::make_shared<MVQNAcceleration>(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timeWindowsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner,
+          _config.alwaysBuildJacobian,
+          _config.imvjRestartType,
+          _config.imvjChunkSize,
+          _config.imvjRSLS_reusedTimeWindows,
+          _config.imvjRSSVD_truncationEps);
+      imvj->setOrthogonalization(_config.orthogonalization);
+      imvj->setMaxRank(_config.imvjRSSVD_maxRank);
+      _acceleration = imvj;
 #else
       PRECICE_ERROR("Acceleration IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -370,6 +388,20 @@ void AccelerationConfiguration::addCommonIQNSubtags(xml::XMLTag &tag)
                             .setDocumentation("Type of the filter.");
   tagFilter.addAttribute(attrFilterName);
   tag.addSubtag(tagFilter);
+
+  XMLTag tagOrthogonalization(*this, TAG_ORTHOGONALIZATION, XMLTag::OCCUR_NOT_OR_ONCE);
+  tagOrthogonalization.setDocumentation("Variant of the Gram-Schmidt process, which inserts new columns into the QR-decomposition "
+                                        "of the least-squares system. Possible variants:\n"
+                                        " - `gram-schmidt`: one global reduction per column of the least-squares system, "
+                                        "the process is repeated if orthogonality is lost\n"
+                                        " - `CGS2`: classical Gram-Schmidt with reorthogonalization, which needs three global "
+                                        "reductions per inserted column, independent of the number of columns");
+  auto attrOrthogonalizationName = XMLAttribute<std::string>(ATTR_TYPE)
+                                       .setOptions({VALUE_GRAM_SCHMIDT,
+                                                    VALUE_CGS2})
+                                       .setDocumentation("Type of the Gram-Schmidt process.");
+  tagOrthogonalization.addAttribute(attrOrthogonalizationName);
+  tag.addSubtag(tagOrthogonalization);
 }
 
 void AccelerationConfiguration::addTypeSpecificSubtags(
@@ -478,9 +510,14 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                               .setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time windows at restart can be specified.");
     auto attrRSSVD_truncationEps = makeXMLAttribute(ATTR_RSSVD_TRUNCATIONEPS, 1e-4)
                                        .setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
+    auto attrRSSVD_maxRank = makeXMLAttribute(ATTR_RSSVD_MAXRANK, 0)
+                                 .setDocumentation("If IMVJ restart-mode=RS-SVD, bounds the rank of the low-rank representation of the inverse Jacobian. "
+                                                   "The stored factors are compressed into the truncated SVD as soon as their total number of columns exceeds this rank, "
+                                                   "which bounds the memory per rank independent of the chunk-size. A value of 0 disables the bound.");
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeWindowsAtRestart);
     tagIMVJRESTART.addAttribute(attrRSSVD_truncationEps);
+    tagIMVJRESTART.addAttribute(attrRSSVD_maxRank);
     tag.addSubtag(tagIMVJRESTART);
 
     XMLTag tagMaxUsedIter(*this, TAG_MAX_USED_ITERATIONS, XMLTag::OCCUR_ONCE);
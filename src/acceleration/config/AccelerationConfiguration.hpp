@@ -6,6 +6,7 @@
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/MVQNAcceleration.hpp"
 #include "acceleration/SharedPointer.hpp"
+#include "acceleration/impl/QRFactorization.hpp"
 #include "acceleration/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -52,6 +53,7 @@ private:
   const std::string TAG_ESTIMATEJACOBIAN;
   const std::string TAG_PRECONDITIONER;
   const std::string TAG_IMVJRESTART;
+  const std::string TAG_ORTHOGONALIZATION;
 
   const std::string ATTR_NAME;
   const std::string ATTR_MESH;
@@ -64,6 +66,7 @@ private:
   const std::string ATTR_IMVJCHUNKSIZE;
   const std::string ATTR_RSLS_REUSED_TIME_WINDOWS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
+  const std::string ATTR_RSSVD_MAXRANK;
   const std::string ATTR_PRECOND_NONCONST_TIME_WINDOWS;
 
   const std::string VALUE_CONSTANT;
@@ -83,6 +86,8 @@ private:
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
   const std::string VALUE_NO_RESTART;
+  const std::string VALUE_GRAM_SCHMIDT;
+  const std::string VALUE_CGS2;
 
   const mesh::PtrMeshConfiguration _meshConfig;
 
@@ -109,12 +114,15 @@ private:
     int                   imvjRestartType            = 0;
     int                   imvjChunkSize              = 0;
     int                   imvjRSLS_reusedTimeWindows = 0;
+    int                   imvjRSSVD_maxRank          = 0;
     int                   precond_nbNonConstTWindows = -1;
     double                singularityLimit           = 0;
     double                imvjRSSVD_truncationEps    = 0;
     bool                  estimateJacobian           = false;
     bool                  alwaysBuildJacobian        = false;
     std::string           preconditionerType;
+
+    impl::QRFactorization::Orthogonalization orthogonalization = impl::QRFactorization::Orthogonalization::GRAM_SCHMIDT;
   } _config;
 
   void addTypeSpecificSubtags(xml::XMLTag &tag);
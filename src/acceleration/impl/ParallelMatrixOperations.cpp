@@ -1,7 +1,9 @@
 #ifndef PRECICE_NO_MPI
 
 #include "acceleration/impl/ParallelMatrixOperations.hpp"
+#include <cstddef>
 #include "utils/MasterSlave.hpp"
+#include "utils/Threading.hpp"
 
 namespace precice {
 namespace acceleration {
@@ -28,6 +30,31 @@ ParallelMatrixOperations::~ParallelMatrixOperations()
   }
 }
 
+void ParallelMatrixOperations::localProduct(
+    const Eigen::Ref<const Eigen::MatrixXd> &leftMatrix,
+    const Eigen::Ref<const Eigen::MatrixXd> &rightMatrix,
+    Eigen::Ref<Eigen::MatrixXd>              result)
+{
+  PRECICE_ASSERT(leftMatrix.cols() == rightMatrix.rows(), leftMatrix.cols(), rightMatrix.rows());
+  PRECICE_ASSERT(result.rows() == leftMatrix.rows(), result.rows(), leftMatrix.rows());
+  PRECICE_ASSERT(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
+
+  // Spawning threads does not pay off for small products such as matrix-vector products of the least-squares system
+  constexpr Eigen::Index minimalThreadedWork = 1 << 20;
+  const Eigen::Index     work                = result.size() * leftMatrix.cols();
+
+  if (leftMatrix.cols() == 0) {
+    result.setZero();
+  } else if (work < minimalThreadedWork || utils::Threading::getNumberOfThreads() == 1) {
+    result.noalias() = leftMatrix * rightMatrix;
+  } else {
+    utils::Threading::parallelFor(result.rows(), [&](std::size_t begin, std::size_t end) {
+      const auto rows                          = static_cast<Eigen::Index>(end - begin);
+      result.middleRows(begin, rows).noalias() = leftMatrix.middleRows(begin, rows) * rightMatrix;
+    });
+  }
+}
+
 void ParallelMatrixOperations::establishCircularCommunication()
 {
   PRECICE_ASSERT(_needCyclicComm);
@@ -3,6 +3,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include <Eigen/Core>
+#include <array>
 #include <memory>
 #include <stddef.h>
 #include <string>
@@ -44,7 +45,7 @@ public:
 
     // if serial computation on single processor, i.e, no master-slave mode
     if (!utils::MasterSlave::isParallel()) {
-      result.noalias() = leftMatrix * rightMatrix;
+      localProduct(leftMatrix, rightMatrix, result);
 
       // if parallel computation on p processors, i.e., master-slave mode
     } else {
@@ -113,6 +114,16 @@ public:
 private:
   logging::Logger _log{"acceleration::ParallelMatrixOperations"};
 
+  /** @brief Computes the fully local product result = leftMatrix * rightMatrix.
+   *
+   *  Large products are split into blocks of rows of the result, which are computed
+   *  concurrently by the number of threads configured in utils::Threading.
+   */
+  static void localProduct(
+      const Eigen::Ref<const Eigen::MatrixXd> &leftMatrix,
+      const Eigen::Ref<const Eigen::MatrixXd> &rightMatrix,
+      Eigen::Ref<Eigen::MatrixXd>              result);
+
   // @brief multiplies matrices based on a cyclic communication and block-wise matrix multiplication with a quadratic result matrix
   template <typename Derived1, typename Derived2>
   void _multiplyNN(
@@ -139,11 +150,19 @@ private:
     PRECICE_ASSERT(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     PRECICE_ASSERT(result.rows() == p, result.rows(), p);
 
-    //int nextProc = (utils::MasterSlave::getRank() + 1) % utils::MasterSlave::getSize();
-    int prevProc = (utils::MasterSlave::getRank() - 1 < 0) ? utils::MasterSlave::getSize() - 1 : utils::MasterSlave::getRank() - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    const int size = utils::MasterSlave::getSize();
+    const int rank = utils::MasterSlave::getRank();
+
+    // proc that owned the block of leftMatrix (W_til), which is multiplied in the given cycle
+    auto sourceProc = [size, rank](int cycle) { return (rank - cycle + size) % size; };
+    auto localRows  = [&offsets](int proc) { return offsets[proc + 1] - offsets[proc]; };
+
+    /*
+     * Double buffering: while the block received in the previous cycle is multiplied and handed
+     * over to the next proc, the block for the next cycle is received into the other buffer.
+     */
+    std::array<Eigen::MatrixXd, 2> buffers;
+    int                            current = 0;
 
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
@@ -153,68 +172,54 @@ private:
       requestSend = _cyclicCommRight->aSend(leftMatrix, 0);
 
     // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv, 0);
+    buffers[current].resize(localRows(sourceProc(1)), q);
+    if (buffers[current].size() > 0)
+      requestRcv = _cyclicCommLeft->aReceive(buffers[current], 0);
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
-    int off = offsets[utils::MasterSlave::getRank()];
-    PRECICE_ASSERT(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    PRECICE_ASSERT(result.cols() == leftMatrix.rows(), result.cols(), leftMatrix.rows());
+    localProduct(leftMatrix, rightMatrix, result.block(offsets[rank], 0, leftMatrix.rows(), result.cols()));
 
     /**
-		 * cyclic send-receive operation
-		 */
-    for (int cycle = 1; cycle < utils::MasterSlave::getSize(); cycle++) {
-
-      // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
-        requestSend->wait();
-      if (requestRcv != NULL)
+     * cyclic send-receive operation
+     */
+    for (int cycle = 1; cycle < size; cycle++) {
+      // wait until W_til from previous processor is fully received and the buffer of the previous send is free again
+      if (requestRcv) {
         requestRcv->wait();
-
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::getSize() - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy, 0);
+        requestRcv.reset();
+      }
+      if (requestSend) {
+        requestSend->wait();
+        requestSend.reset();
       }
 
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
-      int sourceProc_nextCycle = (utils::MasterSlave::getRank() - (cycle + 1) < 0) ? utils::MasterSlave::getSize() + (utils::MasterSlave::getRank() - (cycle + 1)) : utils::MasterSlave::getRank() - (cycle + 1);
-
-      int sourceProc = (utils::MasterSlave::getRank() - cycle < 0) ? utils::MasterSlave::getSize() + (utils::MasterSlave::getRank() - cycle) : utils::MasterSlave::getRank() - cycle;
+      Eigen::MatrixXd &block     = buffers[current];
+      Eigen::MatrixXd &nextBlock = buffers[1 - current];
 
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
+      if (cycle < size - 1) {
+        // initiate async send to hand over the block to the next proc (this data will be needed in the next cycle)
+        if (block.size() > 0)
+          requestSend = _cyclicCommRight->aSend(block, 0);
 
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
-      if (cycle < utils::MasterSlave::getSize() - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv, 0);
+        // initiate asynchronous receive operation for the block of the next cycle
+        nextBlock.resize(localRows(sourceProc(cycle + 1)), q);
+        if (nextBlock.size() > 0) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(nextBlock, 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
-
-      // set block at corresponding index in J_inv
+      // compute block with new data, while the blocks for the next cycle are in flight
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
-      off = offsets[sourceProc];
-      PRECICE_ASSERT(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      localProduct(block, rightMatrix, result.block(offsets[sourceProc(cycle)], 0, block.rows(), result.cols()));
+
+      current = 1 - current;
     }
+
+    if (requestSend)
+      requestSend->wait();
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
@@ -271,8 +276,8 @@ private:
 
     // multiply local block (saxpy-based approach)
     // dimension: (n_global x n_local) * (n_local x m) = (n_global x m)
-    Eigen::MatrixXd block = Eigen::MatrixXd::Zero(p, r);
-    block.noalias()       = leftMatrix * rightMatrix;
+    Eigen::MatrixXd block(p, r);
+    localProduct(leftMatrix, rightMatrix, block);
 
     // all blocks have size (n_global x m)
     // Note: if procs have no vertices, the block size remains (n_global x m), however,
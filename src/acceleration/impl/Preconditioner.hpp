@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "cplscheme/SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
 #include "utils/assertion.hpp"
@@ -202,6 +204,31 @@ public:
     return _frozen;
   }
 
+  /// Writes the weights and the counter of non-const time windows to a checkpoint.
+  virtual void exportState(io::BinaryWriter &writer) const
+  {
+    writer.write(_weights);
+    writer.write(_invWeights);
+    writer.write(_nbNonConstTimeWindows);
+    writer.write(_requireNewQR);
+    writer.write(_frozen);
+  }
+
+  /// Restores the state written by exportState(), requires an initialized preconditioner of the same size.
+  virtual void importState(io::BinaryReader &reader)
+  {
+    const auto size = _weights.size();
+    reader.read(_weights);
+    reader.read(_invWeights);
+    PRECICE_CHECK(_weights.size() == size && _invWeights.size() == size,
+                  "The checkpoint holds {} preconditioner weights, but the coupling data on this rank requires {}. "
+                  "Please restart with the same configuration and partitioning as the checkpointed run.",
+                  _weights.size(), size);
+    reader.read(_nbNonConstTimeWindows);
+    reader.read(_requireNewQR);
+    reader.read(_frozen);
+  }
+
 protected:
   /// Weights used to scale the matrix V and the residual
   std::vector<double> _weights;
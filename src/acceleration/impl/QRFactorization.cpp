@@ -1,5 +1,6 @@
 
 #include <Eigen/Core>
+#include <Eigen/QR>
 #include <algorithm> // std::sort
 #include <cmath>
 #include <cstddef>
@@ -12,15 +13,38 @@
 #include "acceleration/impl/QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "precice/types.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
+#include "utils/span.hpp"
 
 namespace precice {
 namespace acceleration {
 namespace impl {
 
+namespace {
+
+/// Returns the R factor of the Householder QR of A, padded with zero rows to a square matrix
+Eigen::MatrixXd householderR(const Eigen::MatrixXd &A)
+{
+  const Eigen::Index cols = A.cols();
+  Eigen::MatrixXd    R    = Eigen::MatrixXd::Zero(cols, cols);
+  if (A.rows() > 0) {
+    const Eigen::HouseholderQR<Eigen::MatrixXd> qr(A);
+    const Eigen::Index                          rows = std::min(A.rows(), cols);
+    R.topRows(rows)                                  = qr.matrixQR().topRows(rows).triangularView<Eigen::Upper>();
+  }
+  return R;
+}
+
+/// Columns whose diagonal entry in R is below this fraction of the largest one are treated as linearly dependent by the TSQR
+constexpr double tsqrDependenceLimit = 1e-8;
+
+} // namespace
+
 QRFactorization::QRFactorization(
     Eigen::MatrixXd Q,
     Eigen::MatrixXd R,
@@ -142,6 +166,17 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
       }
     }
   } else if (_filter == Acceleration::QR2FILTER) {
+    // The bulk factorization is kept, if the filter discards no column. The criterion below is the
+    // one of insertColumn(), since ||R(:,k)|| = ||v_k|| and |R(k,k)| = ||v_k orthogonalized to v_0..v_k-1||.
+    if (resetTSQR(V)) {
+      bool discardsColumn = false;
+      for (int k = 0; k < _cols; k++) {
+        discardsColumn |= (_R.col(k).norm() * singularityLimit > std::fabs(_R(k, k)));
+      }
+      if (not discardsColumn) {
+        return;
+      }
+    }
     _Q.resize(0, 0);
     _R.resize(0, 0);
     _cols = 0;
@@ -226,10 +261,13 @@ bool QRFactorization::insertColumn(int k, const Eigen::VectorXd &vec, double sin
   // orthogonalize v to columns of Q
   Eigen::VectorXd u(_cols);
   double          rho_orth = 0., rho0 = 0.;
-  if (applyFilter)
+  if (applyFilter) {
     rho0 = utils::MasterSlave::l2norm(v);
+    _reductions++;
+  }
 
-  int err = orthogonalize(v, u, rho_orth, _cols - 1);
+  int err = (_orthogonalization == Orthogonalization::CGS2) ? orthogonalizeCGS2(v, u, rho_orth, _cols - 1)
+                                                            : orthogonalize(v, u, rho_orth, _cols - 1);
 
   // on of the following is true
   // - either ||v_orth|| / ||v|| <= 0.7 was true and the re-orthogonalization process failed 4 times
@@ -334,6 +372,7 @@ int QRFactorization::orthogonalize(
   rho   = utils::MasterSlave::l2norm(v); // distributed l2norm
   rho0  = rho;
   int k = 0;
+  _reductions++;
   while (!termination) {
 
     // take a gram-schmidt iteration
@@ -364,6 +403,7 @@ int QRFactorization::orthogonalize(
     // t = norm of r_(:,j) with j = colNum-1
     double norm_coefficients = utils::MasterSlave::l2norm(s); // distributed l2norm
     k++;
+    _reductions += colNum + 2;
 
     // treat the special case m=n
     // Attention (Master-Slave): Here, we need to compare the global _rows with colNum and NOT the local
@@ -452,6 +492,7 @@ int QRFactorization::orthogonalize_stable(
   rho   = utils::MasterSlave::l2norm(v); // distributed l2norm
   rho0  = rho;
   int k = 0;
+  _reductions++;
   while (!termination) {
     // take a gram-schmidt iteration, ignoring r on later steps if previous v was null
     u = Eigen::VectorXd::Zero(_rows);
@@ -488,6 +529,7 @@ int QRFactorization::orthogonalize_stable(
     // t = norm of r_(:,j) with j = colNum-1
     t = utils::MasterSlave::l2norm(s); // distributed l2norm
     k++;
+    _reductions += colNum + 2;
 
     // treat the special case m=n
     // Attention (Master-Slave): Here, we need to compare the global _rows with colNum and NOT the local
@@ -612,6 +654,147 @@ int QRFactorization::orthogonalize_stable(
   return k;
 }
 
+int QRFactorization::orthogonalizeCGS2(
+    Eigen::VectorXd &v,
+    Eigen::VectorXd &r,
+    double &         rho,
+    int              colNum)
+{
+  PRECICE_TRACE();
+
+  if (!utils::MasterSlave::isParallel()) {
+    PRECICE_ASSERT(_globalRows == _rows, _globalRows, _rows);
+  }
+
+  r = Eigen::VectorXd::Zero(_cols);
+
+  // treat the special case m=n, see orthogonalize()
+  if (_globalRows == colNum) {
+    PRECICE_WARN("The least-squares system matrix is quadratic, i.e., the new column cannot be orthogonalized (and thus inserted) to the LS-system.\nOld columns need to be removed.");
+    v   = Eigen::VectorXd::Zero(_rows);
+    rho = 0.;
+    return 1;
+  }
+
+  const auto      Q = _Q.leftCols(colNum);
+  Eigen::VectorXd localProjections(colNum + 1);
+  Eigen::VectorXd projections(colNum + 1);
+
+  // computes (Q^T v, v^T v) over all ranks in a single reduction
+  auto reduceProjections = [&]() {
+    // Q has no rows yet, if the first column is inserted into an empty factorization
+    if (colNum > 0) {
+      localProjections.head(colNum).noalias() = Q.transpose() * v;
+    }
+    localProjections(colNum) = v.squaredNorm();
+    utils::MasterSlave::allreduceSum(precice::span<const double>{localProjections.data(), static_cast<size_t>(colNum + 1)},
+                                     precice::span<double>{projections.data(), static_cast<size_t>(colNum + 1)});
+    _reductions++;
+  };
+
+  reduceProjections();
+  double rho0 = std::sqrt(projections(colNum));
+  rho         = rho0;
+  int k       = 0;
+  while (true) {
+    // take a classical gram-schmidt pass, all coefficients stem from the same v
+    const Eigen::VectorXd s = projections.head(colNum);
+    r.head(colNum) += s;
+    if (colNum > 0) {
+      v.noalias() -= Q * s;
+    }
+    k++;
+
+    // the norm of v_orth is reduced together with the coefficients of a further pass
+    reduceProjections();
+    const double rho1 = std::sqrt(projections(colNum));
+
+    // take correct action if v_orth is null
+    if (rho1 <= std::numeric_limits<double>::min()) {
+      PRECICE_DEBUG("The norm of v_orthogonal is almost zero, i.e., failed to orthogonalize column v; discard.");
+      rho       = 0.;
+      r(colNum) = rho;
+      return k;
+    }
+
+    // the second pass is always taken, further ones only if ||v_orth|| / ||v|| <= 1/theta
+    const bool reorthogonalize = (colNum > 0) && (k < 2 || rho1 * _theta <= rho0 + _omega * s.norm());
+    if (not reorthogonalize) {
+      v /= rho1;
+      rho       = rho1;
+      r(colNum) = rho;
+      return k;
+    }
+    // exit to fail if too many iterations
+    if (k >= 4) {
+      PRECICE_WARN("Matrix Q is not sufficiently orthogonal. Failed to rorthogonalize new column after 4 iterations. New column will be discarded. The least-squares system is very bad conditioned and the quasi-Newton will most probably fail to converge.");
+      return -1;
+    }
+    rho0 = rho1;
+  }
+}
+
+Eigen::MatrixXd QRFactorization::computeTSQRFactor(const Eigen::MatrixXd &A)
+{
+  PRECICE_TRACE(A.rows(), A.cols());
+  const Eigen::Index cols = A.cols();
+  Eigen::MatrixXd    R    = householderR(A);
+
+  if (utils::MasterSlave::isParallel()) {
+    // the R factor of two stacked row blocks is the R factor of their stacked R factors
+    auto merge = [cols](precice::span<double> items, precice::span<const double> received) {
+      Eigen::Map<Eigen::MatrixXd>       R1(items.data(), cols, cols);
+      Eigen::Map<const Eigen::MatrixXd> R2(received.data(), cols, cols);
+      Eigen::MatrixXd                   stacked(2 * cols, cols);
+      stacked << R1, R2;
+      R1 = householderR(stacked);
+    };
+    const precice::span<double> items{R.data(), static_cast<size_t>(R.size())};
+    if (utils::MasterSlave::isMaster()) {
+      utils::MasterSlave::_communication->allreduce(items, merge);
+    } else {
+      utils::MasterSlave::_communication->allreduce(items, merge, 0);
+    }
+    _reductions++;
+  }
+  return R;
+}
+
+bool QRFactorization::resetTSQR(const Eigen::MatrixXd &A)
+{
+  PRECICE_TRACE();
+  const int cols = A.cols();
+  if (cols == 0 || cols > _globalRows) {
+    return false;
+  }
+
+  Eigen::MatrixXd R1       = computeTSQRFactor(A);
+  const double    diagonal = R1.diagonal().cwiseAbs().maxCoeff();
+  if (not(R1.diagonal().cwiseAbs().minCoeff() > tsqrDependenceLimit * diagonal)) {
+    PRECICE_DEBUG("The TSQR detected (almost) linearly dependent columns, fall back to inserting the columns one by one.");
+    return false;
+  }
+  // Q1 = A R1^-1 loses orthogonality proportional to the condition of A, a second pass restores it
+  Eigen::MatrixXd Q  = R1.triangularView<Eigen::Upper>().solve<Eigen::OnTheRight>(A);
+  Eigen::MatrixXd R2 = computeTSQRFactor(Q);
+  R2.triangularView<Eigen::Upper>().solveInPlace<Eigen::OnTheRight>(Q);
+  Eigen::MatrixXd R = R2 * R1;
+
+  // fix the signs, such that the diagonal of R is positive as in orthogonalize()
+  for (int k = 0; k < cols; k++) {
+    if (R(k, k) < 0) {
+      R.row(k) *= -1;
+      Q.col(k) *= -1;
+    }
+  }
+
+  _Q    = std::move(Q);
+  _R    = std::move(R);
+  _rows = A.rows();
+  _cols = cols;
+  return true;
+}
+
 /**
  * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
  */
@@ -722,15 +905,20 @@ void QRFactorization::reset(
     double                 sigma)
 {
   PRECICE_TRACE();
-  _Q.resize(0, 0);
-  _R.resize(0, 0);
-  _cols       = 0;
-  _rows       = A.rows();
   _omega      = omega;
   _theta      = theta;
   _sigma      = sigma;
   _globalRows = globalRows;
 
+  if (resetTSQR(A)) {
+    return;
+  }
+
+  _Q.resize(0, 0);
+  _R.resize(0, 0);
+  _cols = 0;
+  _rows = A.rows();
+
   int m   = A.cols();
   int col = 0, k = 0;
   for (; col < m; k++, col++) {
@@ -779,6 +967,36 @@ void QRFactorization::setFilter(int filter)
   _filter = filter;
 }
 
+void QRFactorization::setOrthogonalization(Orthogonalization orthogonalization)
+{
+  _orthogonalization = orthogonalization;
+}
+
+int QRFactorization::getReductionCount() const
+{
+  return _reductions;
+}
+
+void QRFactorization::exportState(io::BinaryWriter &writer) const
+{
+  writer.write(_Q);
+  writer.write(_R);
+  writer.write(_rows);
+  writer.write(_cols);
+  writer.write(_globalRows);
+}
+
+void QRFactorization::importState(io::BinaryReader &reader)
+{
+  reader.read(_Q);
+  reader.read(_R);
+  reader.read(_rows);
+  reader.read(_cols);
+  reader.read(_globalRows);
+  PRECICE_CHECK(_Q.rows() == _rows && _Q.cols() == _cols && _R.rows() == _cols && _R.cols() == _cols,
+                "The checkpoint holds an inconsistent QR-decomposition of size {}x{}.", _rows, _cols);
+}
+
 } // namespace impl
 } // namespace acceleration
 } // namespace precice
@@ -9,6 +9,11 @@
 #include "mesh/SharedPointer.hpp"
 
 namespace precice {
+namespace io {
+class BinaryReader;
+class BinaryWriter;
+} // namespace io
+
 namespace acceleration {
 namespace impl {
 
@@ -22,6 +27,14 @@ namespace impl {
  */
 class QRFactorization {
 public:
+  /// Variants of the Gram-Schmidt process, which orthogonalizes inserted columns to Q
+  enum class Orthogonalization {
+    /// One global reduction per column of Q, the process is repeated if orthogonality is lost
+    GRAM_SCHMIDT,
+    /// Classical Gram-Schmidt with reorthogonalization, one global reduction per pass for all columns of Q
+    CGS2
+  };
+
   /**
    * @brief Constructor.
    * @param theta - singularity limit for reothogonalization ||v_orth|| / ||v|| <= 1/theta
@@ -158,6 +171,18 @@ public:
   // @brief sets the filtering technique to maintain good conditioning of the least squares system
   void setFilter(int filter);
 
+  // @brief sets the variant of the Gram-Schmidt process used to insert columns
+  void setOrthogonalization(Orthogonalization orthogonalization);
+
+  // @brief returns the number of global reductions issued by the factorization so far
+  int getReductionCount() const;
+
+  // @brief writes the factors Q and R and their dimensions to a checkpoint
+  void exportState(io::BinaryWriter &writer) const;
+
+  // @brief restores the factors written by exportState()
+  void importState(io::BinaryReader &reader);
+
 private:
   struct givensRot {
     int    i, j;
@@ -191,6 +216,32 @@ private:
    */
   int orthogonalize(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
 
+  /**
+   * @short classical Gram-Schmidt with reorthogonalization (CGS2), see orthogonalize() for the parameters.
+   *
+   *   All Fourier coefficients of a pass are computed as Q^T v and reduced together with the
+   *   squared norm of v in a single global reduction. The second pass is always taken, further
+   *   passes follow the same criterion as in orthogonalize(). Hence, inserting a column needs
+   *   three global reductions independent of the number of columns in Q.
+   */
+  int orthogonalizeCGS2(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
+
+  /**
+   * @short replaces the factorization by the one of A, computed as tall-skinny QR (TSQR).
+   *
+   *   Every rank factorizes its rows of A by a Householder QR. The R factors are merged along the
+   *   collective tree of the master-slave communication, i.e., by QR-decompositions of pairs of
+   *   stacked R factors, and distributed to all ranks. Q follows from A by a triangular solve with R,
+   *   which is repeated once to restore the orthogonality lost in this solve.
+   *
+   *   @return false, if A is (almost) rank deficient. The factorization is not modified in this case,
+   *   as columns need to be discarded column by column.
+   */
+  bool resetTSQR(const Eigen::MatrixXd &A);
+
+  /// Returns the R factor of the tall-skinny QR of A, see resetTSQR()
+  Eigen::MatrixXd computeTSQRFactor(const Eigen::MatrixXd &A);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
@@ -220,6 +271,11 @@ private:
   bool          _fstream_set;
 
   int _globalRows;
+
+  Orthogonalization _orthogonalization = Orthogonalization::GRAM_SCHMIDT;
+
+  /// Number of global reductions issued so far
+  int _reductions = 0;
 };
 
 } // namespace impl
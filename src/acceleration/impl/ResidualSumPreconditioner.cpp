@@ -24,6 +24,21 @@ void ResidualSumPreconditioner::initialize(std::vector<size_t> &svs)
   _residualSum.resize(_subVectorSizes.size(), 0.0);
 }
 
+void ResidualSumPreconditioner::exportState(io::BinaryWriter &writer) const
+{
+  Preconditioner::exportState(writer);
+  writer.write(_residualSum);
+}
+
+void ResidualSumPreconditioner::importState(io::BinaryReader &reader)
+{
+  Preconditioner::importState(reader);
+  reader.read(_residualSum);
+  PRECICE_CHECK(_residualSum.size() == _subVectorSizes.size(),
+                "The checkpoint holds residual sums of {} data, but the preconditioner requires {}.",
+                _residualSum.size(), _subVectorSizes.size());
+}
+
 void ResidualSumPreconditioner::_update_(bool                   timeWindowComplete,
                                          const Eigen::VectorXd &oldValues,
                                          const Eigen::VectorXd &res)
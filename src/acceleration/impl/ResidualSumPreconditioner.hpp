@@ -25,6 +25,10 @@ public:
 
   virtual void initialize(std::vector<size_t> &svs);
 
+  virtual void exportState(io::BinaryWriter &writer) const;
+
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /**
    * @brief Update the scaling after every FSI iteration.
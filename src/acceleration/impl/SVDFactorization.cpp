@@ -263,11 +263,38 @@ bool SVDFactorization::isPrecondApplied()
 }
 */
 
+std::size_t SVDFactorization::storedEntries() const
+{
+  return _psi.size() + _sigma.size() + _phi.size();
+}
+
 bool SVDFactorization::isSVDinitialized()
 {
   return _initialSVD;
 }
 
+void SVDFactorization::exportState(io::BinaryWriter &writer) const
+{
+  writer.write(_psi);
+  writer.write(_phi);
+  writer.write(_sigma);
+  writer.write(_rows);
+  writer.write(_cols);
+  writer.write(_initialSVD);
+}
+
+void SVDFactorization::importState(io::BinaryReader &reader)
+{
+  reader.read(_psi);
+  reader.read(_phi);
+  reader.read(_sigma);
+  reader.read(_rows);
+  reader.read(_cols);
+  reader.read(_initialSVD);
+  PRECICE_CHECK(_psi.rows() == _rows && _phi.rows() == _rows && _psi.cols() == _cols && _phi.cols() == _cols && _sigma.size() == _cols,
+                "The checkpoint holds an inconsistent SVD factorization of rank {}.", _cols);
+}
+
 void SVDFactorization::setThreshold(double eps)
 {
   _truncationEps = eps;
@@ -278,6 +305,17 @@ double SVDFactorization::getThreshold()
   return _truncationEps;
 }
 
+void SVDFactorization::setMaxRank(int maxRank)
+{
+  PRECICE_ASSERT(maxRank >= 0, maxRank);
+  _maxRank = maxRank;
+}
+
+int SVDFactorization::getMaxRank()
+{
+  return _maxRank;
+}
+
 int SVDFactorization::getWaste()
 {
   int r  = _waste;
@@ -18,6 +18,8 @@
 #include "acceleration/impl/Preconditioner.hpp"
 #include "acceleration/impl/QRFactorization.hpp"
 #include "acceleration/impl/SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
 #include "precice/types.hpp"
@@ -54,7 +56,7 @@ public:
   /** @brief: updates the SVD decomposition with the rank-1 update A*B^T, i.e.,
     *               _psi * _sigma * _phi^T + A*B^T
     *  and overrides the internal SVD representation. After the update, the SVD is
-    *  truncated according to the threshold _truncationEps
+    *  truncated according to the threshold _truncationEps and to at most _maxRank modes.
     */
   template <typename Derived1, typename Derived2>
   void update(
@@ -167,6 +169,10 @@ public:
         break;
       }
     }
+    if (_maxRank > 0 && _cols > _maxRank) {
+      waste += _cols - _maxRank;
+      _cols = _maxRank;
+    }
     _waste += waste;
 
     _psi.conservativeResize(_rows, _cols);
@@ -212,6 +218,9 @@ public:
   /// @brief: returns the rank of the truncated SVD factorization
   Rank rank();
 
+  /// @brief: returns the number of stored entries of the factors Psi, Sigma and Phi
+  std::size_t storedEntries() const;
+
   /// @brief: returns the total number of truncated modes since last call to this method
   int getWaste();
 
@@ -221,6 +230,12 @@ public:
   /// @brief: returns the truncation threshold for the SVD
   double getThreshold();
 
+  /// @brief: sets the maximal rank of the truncated SVD, 0 means unbounded
+  void setMaxRank(int maxRank);
+
+  /// @brief: returns the maximal rank of the truncated SVD, 0 means unbounded
+  int getMaxRank();
+
   /// @brief: applies the preconditioner to the factorized and truncated representation of the Jacobian matrix
   //void applyPreconditioner();
 
@@ -236,6 +251,12 @@ public:
 
   bool isSVDinitialized();
 
+  /// @brief: writes the truncated SVD factorization to a checkpoint
+  void exportState(io::BinaryWriter &writer) const;
+
+  /// @brief: restores the truncated SVD factorization written by exportState()
+  void importState(io::BinaryReader &reader);
+
   /// Optional file-stream for logging output
   void setfstream(std::fstream *stream);
 
@@ -282,6 +303,9 @@ private:
   /// Truncation parameter for the updated SVD decomposition
   double _truncationEps;
 
+  /// Maximal number of modes kept after an update, 0 means unbounded
+  int _maxRank = 0;
+
   /// Threshold for the QR2 filter for the QR decomposition.
   double _epsQR2 = 1e-3;
 
@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/BaseQNAcceleration.hpp"
 #include "acceleration/IQNILSAcceleration.hpp"
@@ -10,6 +11,8 @@
 #include "acceleration/impl/SharedPointer.hpp"
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -108,6 +111,164 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   BOOST_TEST(testing::equals(data.at(1)->values()(3), 8.28025852497733250157e-02));
 }
 
+BOOST_AUTO_TEST_CASE(testMVQNRankBound)
+{
+  PRECICE_TEST(1_rank);
+  const int    n             = 8;
+  const int    maxRank       = 2;
+  const int    timeWindows   = 6;
+  const double tolerance     = 1e-10;
+  const int    maxIterations = 30;
+
+  // linear fixed-point problem x = A*x + b with a right-hand side changing in every time window
+  Eigen::MatrixXd A(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      A(i, j) = 0.9 / n * std::cos(i + 2.0 * j);
+    }
+  }
+
+  std::vector<double> factors(1, 1.0);
+  std::vector<int>    dataIDs{0};
+
+  for (int rankBound : {maxRank, 0}) {
+    impl::PtrPreconditioner prec(new impl::ConstantPreconditioner(factors));
+    mesh::PtrMesh           dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+    MVQNAcceleration        pp(0.1, false, 50, 0, Acceleration::QR1FILTER, 1e-10, dataIDs, prec, false,
+                               MVQNAcceleration::RS_SVD, 8, 0, 1e-12);
+    pp.setMaxRank(rankBound);
+
+    mesh::PtrData values(new mesh::Data("values", -1, 1));
+    values->values() = Eigen::VectorXd::Zero(n);
+    cplscheme::PtrCouplingData cplData(new cplscheme::CouplingData(values, dummyMesh, false));
+    DataMap                    data;
+    data.insert(std::pair<int, cplscheme::PtrCouplingData>(0, cplData));
+    cplData->storeIteration();
+    pp.initialize(data);
+
+    for (int t = 0; t < timeWindows; t++) {
+      Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, 1.0, 2.0) * (1.0 + 0.3 * t);
+      bool            converged = false;
+      for (int it = 0; it < maxIterations && not converged; it++) {
+        values->values() = A * cplData->previousIteration() + b;
+        converged        = (values->values() - cplData->previousIteration()).norm() < tolerance;
+        if (converged) {
+          pp.iterationsConverged(data);
+        } else {
+          pp.performAcceleration(data);
+        }
+        cplData->storeIteration();
+      }
+      BOOST_TEST(converged);
+
+      if (rankBound > 0) {
+        // the chunks of the current restart cycle and the truncated factors Psi, Sigma and Phi
+        BOOST_TEST(pp.getJacobianMemory() <= (2 * rankBound * n + (2 * n + 1) * rankBound) * sizeof(double));
+      }
+    }
+    if (rankBound == 0) {
+      BOOST_TEST(pp.getJacobianMemory() > 2 * maxRank * n * sizeof(double));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testQNStateRestart)
+{
+  PRECICE_TEST(1_rank);
+  const int    n             = 8;
+  const int    timeWindows   = 6;
+  const int    restartWindow = 3;
+  const double tolerance     = 1e-10;
+  const int    maxIterations = 30;
+
+  // linear fixed-point problem x = A*x + b with a right-hand side changing in every time window
+  Eigen::MatrixXd A(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      A(i, j) = 0.9 / n * std::sin(2.0 * i + j);
+    }
+  }
+
+  std::vector<double> factors(1, 1.0);
+  std::vector<int>    dataIDs{0};
+
+  auto makeAcceleration = [&](bool useIMVJ) -> PtrAcceleration {
+    impl::PtrPreconditioner prec(new impl::ConstantPreconditioner(factors));
+    if (useIMVJ) {
+      return PtrAcceleration(new MVQNAcceleration(0.1, false, 50, 2, Acceleration::QR1FILTER, 1e-10, dataIDs, prec, false,
+                                                  MVQNAcceleration::RS_SVD, 2, 0, 1e-12));
+    }
+    return PtrAcceleration(new IQNILSAcceleration(0.1, false, 50, 2, Acceleration::QR1FILTER, 1e-10, dataIDs, prec));
+  };
+
+  struct Run {
+    PtrAcceleration            acceleration;
+    mesh::PtrData              values;
+    cplscheme::PtrCouplingData cplData;
+    DataMap                    data;
+  };
+
+  auto makeRun = [&](bool useIMVJ) {
+    Run           run;
+    mesh::PtrMesh dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+    run.acceleration      = makeAcceleration(useIMVJ);
+    run.values            = mesh::PtrData(new mesh::Data("values", -1, 1));
+    run.values->values()  = Eigen::VectorXd::Zero(n);
+    run.cplData           = cplscheme::PtrCouplingData(new cplscheme::CouplingData(run.values, dummyMesh, false));
+    run.data.insert(std::pair<int, cplscheme::PtrCouplingData>(0, run.cplData));
+    run.cplData->storeIteration();
+    run.acceleration->initialize(run.data);
+    return run;
+  };
+
+  // returns the number of iterations of every time window
+  auto solve = [&](Run &run, int firstWindow, int lastWindow) {
+    std::vector<int> iterations;
+    for (int t = firstWindow; t < lastWindow; t++) {
+      Eigen::VectorXd b         = Eigen::VectorXd::LinSpaced(n, 1.0, 2.0) * (1.0 + 0.3 * t);
+      bool            converged = false;
+      int             it        = 0;
+      for (; it < maxIterations && not converged; it++) {
+        run.values->values() = A * run.cplData->previousIteration() + b;
+        converged            = (run.values->values() - run.cplData->previousIteration()).norm() < tolerance;
+        if (converged) {
+          run.acceleration->iterationsConverged(run.data);
+        } else {
+          run.acceleration->performAcceleration(run.data);
+        }
+        run.cplData->storeIteration();
+      }
+      BOOST_TEST(converged);
+      iterations.push_back(it);
+    }
+    return iterations;
+  };
+
+  for (bool useIMVJ : {false, true}) {
+    Run reference = makeRun(useIMVJ);
+    solve(reference, 0, restartWindow);
+    std::vector<int> referenceIterations = solve(reference, restartWindow, timeWindows);
+
+    const std::string filename = "acceleration-QNStateRestart.state";
+    {
+      Run interrupted = makeRun(useIMVJ);
+      solve(interrupted, 0, restartWindow);
+      io::BinaryWriter writer(filename);
+      interrupted.cplData->exportState(writer);
+      interrupted.acceleration->exportState(writer);
+    }
+
+    Run              restarted = makeRun(useIMVJ);
+    io::BinaryReader reader(filename);
+    restarted.cplData->importState(reader);
+    restarted.acceleration->importState(reader);
+    std::vector<int> restartedIterations = solve(restarted, restartWindow, timeWindows);
+
+    BOOST_TEST(restartedIterations == referenceIterations, boost::test_tools::per_element());
+    BOOST_TEST(testing::equals(restarted.values->values(), reference.values->values()));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testVIQNPP)
 {
   PRECICE_TEST(1_rank);
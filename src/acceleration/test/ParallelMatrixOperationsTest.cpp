@@ -3,6 +3,8 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <math.h>
 #include <memory>
 #include <ostream>
@@ -16,6 +18,7 @@
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/Threading.hpp"
 
 BOOST_AUTO_TEST_SUITE(AccelerationTests)
 
@@ -323,6 +326,86 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp)
   validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets.at(context.rank), true);
 }
 
+/// Times the cyclic product W * Z = J of the IMVJ for one and two threads per rank and validates the result
+void benchmarkCyclicMultiply(const testing::TestContext &context)
+{
+  const int n_local  = 400;
+  const int n_global = n_local * context.size;
+  const int m_global = 20;
+  const int repeats  = 3;
+
+  std::vector<int> vertexOffsets(context.size + 1);
+  for (int rank = 0; rank <= context.size; rank++) {
+    vertexOffsets[rank] = rank * n_local;
+  }
+  const int off = vertexOffsets[context.rank];
+
+  auto            W_entry = [](int i, int j) { return std::sin(0.1 * i + j); };
+  auto            Z_entry = [](int i, int j) { return std::cos(i - 0.2 * j); };
+  Eigen::MatrixXd W_local(n_local, m_global);
+  Eigen::MatrixXd Z_local(m_global, n_local);
+  Eigen::MatrixXd W_global(n_global, m_global);
+  for (int i = 0; i < n_global; i++)
+    for (int j = 0; j < m_global; j++)
+      W_global(i, j) = W_entry(i, j);
+  for (int i = 0; i < n_local; i++)
+    for (int j = 0; j < m_global; j++) {
+      W_local(i, j) = W_entry(i + off, j);
+      Z_local(j, i) = Z_entry(j, i + off);
+    }
+  Eigen::MatrixXd WZ_reference = W_global * Z_local;
+
+  ParallelMatrixOperations parMatrixOps{};
+  parMatrixOps.initialize(true);
+
+  for (int threads : {1, 2}) {
+    utils::Threading::setNumberOfThreads(threads);
+    Eigen::MatrixXd resWZ_local(n_global, n_local);
+
+    // synchronize the ranks before timing
+    int token = 0, synchronized = 0;
+    utils::MasterSlave::allreduceSum(token, synchronized);
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+      parMatrixOps.multiply(W_local, Z_local, resWZ_local, vertexOffsets, n_global, m_global, n_global);
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    BOOST_TEST(testing::equals(resWZ_local, WZ_reference, 1e-12));
+    if (context.isMaster()) {
+      BOOST_TEST_MESSAGE("ranks: " << context.size << " threads: " << threads
+                                   << " time per product [ms]: " << elapsed.count() / repeats);
+    }
+  }
+  utils::Threading::setNumberOfThreads(1);
+}
+
+BOOST_AUTO_TEST_CASE(BenchmarkCyclicMultiply2Ranks)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  benchmarkCyclicMultiply(context);
+}
+
+BOOST_AUTO_TEST_CASE(BenchmarkCyclicMultiply4Ranks)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  benchmarkCyclicMultiply(context);
+}
+
+/// Run with PRECICE_BENCHMARKS set on 8 ranks
+BOOST_AUTO_TEST_CASE(BenchmarkCyclicMultiply8Ranks, *boost::unit_test::precondition(testing::benchmarksEnabled))
+{
+  PRECICE_TEST(""_on(8_ranks).setupMasterSlaves());
+  benchmarkCyclicMultiply(context);
+}
+
+/// Run with PRECICE_BENCHMARKS set on 16 ranks
+BOOST_AUTO_TEST_CASE(BenchmarkCyclicMultiply16Ranks, *boost::unit_test::precondition(testing::benchmarksEnabled))
+{
+  PRECICE_TEST(""_on(16_ranks).setupMasterSlaves());
+  benchmarkCyclicMultiply(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -1,4 +1,5 @@
 #include <Eigen/Core>
+#include <Eigen/QR>
 #include <math.h>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/BaseQNAcceleration.hpp"
@@ -7,6 +8,8 @@
 #include "cplscheme/Constants.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/span.hpp"
 
 BOOST_AUTO_TEST_SUITE(AccelerationTests)
 
@@ -150,4 +153,88 @@ BOOST_AUTO_TEST_CASE(testQRFactorization)
   testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A);
 }
 
+BOOST_AUTO_TEST_CASE(testQRFactorizationCGS2)
+{
+  PRECICE_TEST(1_rank);
+  int             m = 6, n = 8;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+
+  // insert the columns one by one, as reset(A) computes the factorization by TSQR
+  QRFactorization qrGramSchmidt(BaseQNAcceleration::QR1FILTER);
+  QRFactorization qr(BaseQNAcceleration::QR1FILTER);
+  qr.setOrthogonalization(QRFactorization::Orthogonalization::CGS2);
+  qrGramSchmidt.setGlobalRows(A.rows());
+  qr.setGlobalRows(A.rows());
+  for (int j = 0; j < m; j++) {
+    qrGramSchmidt.insertColumn(j, A.col(j));
+    qr.insertColumn(j, A.col(j));
+  }
+  testQTQequalsIdentity(qr.matrixQ());
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), A);
+
+  // the first column needs one pass, all others at least two, which costs one reduction each
+  BOOST_TEST(qr.getReductionCount() >= 2 + 3 * (m - 1));
+  BOOST_TEST(qr.getReductionCount() < qrGramSchmidt.getReductionCount());
+
+  // ----------- delete and insert middle column ---------------
+  int             k    = 3;
+  Eigen::VectorXd colk = A.col(k);
+  qr.deleteColumn(k);
+  const int reductions = qr.getReductionCount();
+  qr.insertColumn(k, colk);
+  BOOST_TEST(qr.getReductionCount() - reductions <= 5);
+  testQTQequalsIdentity(qr.matrixQ());
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), A);
+}
+
+#ifndef PRECICE_NO_MPI
+BOOST_AUTO_TEST_CASE(testTSQR)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  const int        m = 5;
+  std::vector<int> offsets{0, 7, 8, 8, 20};
+  const int        globalRows = offsets.back();
+  const int        localRows  = offsets[context.rank + 1] - offsets[context.rank];
+
+  Eigen::MatrixXd A(globalRows, m);
+  for (int i = 0; i < globalRows; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1) + std::sin(i * (j + 1));
+    }
+  }
+  Eigen::MatrixXd localA = A.middleRows(offsets[context.rank], localRows);
+
+  QRFactorization qr(BaseQNAcceleration::QR1FILTER);
+  qr.reset(localA, globalRows);
+  BOOST_TEST(qr.cols() == m);
+  BOOST_TEST(qr.rows() == localRows);
+  // one reduction for each of the two passes of the TSQR
+  BOOST_TEST(qr.getReductionCount() == 2);
+
+  // QR equals A on every rank and R equals the serial factorization
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), localA);
+  Eigen::MatrixXd serialR = Eigen::HouseholderQR<Eigen::MatrixXd>(A).matrixQR().topRows(m).triangularView<Eigen::Upper>();
+  for (int i = 0; i < m; i++) {
+    if (serialR(i, i) < 0) {
+      serialR.row(i) *= -1;
+    }
+  }
+  BOOST_TEST(testing::equals(qr.matrixR(), serialR, 1e-12));
+
+  // Q is orthogonal over all ranks
+  Eigen::MatrixXd localQTQ = qr.matrixQ().transpose() * qr.matrixQ();
+  Eigen::MatrixXd QTQ(m, m);
+  utils::MasterSlave::allreduceSum(precice::span<const double>{localQTQ.data(), static_cast<size_t>(localQTQ.size())},
+                                   precice::span<double>{QTQ.data(), static_cast<size_t>(QTQ.size())});
+  BOOST_TEST(testing::equals(QTQ, Eigen::MatrixXd::Identity(m, m), 1e-12));
+}
+#endif // PRECICE_NO_MPI
+
 BOOST_AUTO_TEST_SUITE_END()
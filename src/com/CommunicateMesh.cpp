@@ -1,9 +1,7 @@
 #include <Eigen/Core>
 #include <algorithm>
-#include <boost/container/flat_map.hpp>
 #include <cstddef>
-#include <functional>
-#include <map>
+#include <cstring>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -11,310 +9,222 @@
 
 #include "CommunicateMesh.hpp"
 #include "Communication.hpp"
+#include "com/DeferredRequest.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "precice/types.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
 namespace com {
-CommunicateMesh::CommunicateMesh(
-    com::PtrCommunication communication)
-    : _communication(std::move(communication))
+
+namespace {
+
+/// Number of ints in the header of a serialized mesh: dimensions, number of vertices, edges and triangles
+constexpr size_t headerSize = 4;
+
+/// Returns the number of doubles holding the given number of ints
+size_t doublesForInts(size_t count)
 {
+  return (count * sizeof(int) + sizeof(double) - 1) / sizeof(double);
 }
 
-void CommunicateMesh::sendMesh(
-    const mesh::Mesh &mesh,
-    int               rankReceiver)
+/// Copies the ints to the position and returns the position of the next section
+double *putInts(const std::vector<int> &values, double *position)
 {
-  PRECICE_TRACE(mesh.getName(), rankReceiver);
-  const int dim = mesh.getDimensions();
-
-  const auto &meshVertices     = mesh.vertices();
-  const int   numberOfVertices = meshVertices.size();
-  _communication->send(numberOfVertices, rankReceiver);
-  if (not mesh.vertices().empty()) {
-    std::vector<double> coords(static_cast<size_t>(numberOfVertices) * dim);
-    std::vector<int>    globalIDs(numberOfVertices);
-    for (size_t i = 0; i < static_cast<size_t>(numberOfVertices); ++i) {
-      std::copy_n(meshVertices[i].rawCoords().begin(), dim, &coords[i * dim]);
-      globalIDs[i] = meshVertices[i].getGlobalIndex();
-    }
-    _communication->send(coords, rankReceiver);
-    _communication->send(globalIDs, rankReceiver);
-  }
-
-  const int numberOfEdges = mesh.edges().size();
-  _communication->send(numberOfEdges, rankReceiver);
-  if (not mesh.edges().empty()) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = meshVertices[i].getID();
-    }
-    _communication->send(vertexIDs, rankReceiver);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->send(edgeIDs, rankReceiver);
-  }
+  std::memcpy(position, values.data(), values.size() * sizeof(int));
+  return position + doublesForInts(values.size());
+}
 
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->send(numberOfTriangles, rankReceiver);
-    if (not mesh.triangles().empty()) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->send(edgeIDs, rankReceiver);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->send(triangleIDs, rankReceiver);
-    }
-  }
+/// Copies ints from the position and returns the position of the next section
+const double *getInts(const double *position, std::vector<int> &values)
+{
+  std::memcpy(values.data(), position, values.size() * sizeof(int));
+  return position + doublesForInts(values.size());
 }
 
-void CommunicateMesh::receiveMesh(
-    mesh::Mesh &mesh,
-    int         rankSender)
+/**
+ * @brief Serializes the mesh into a single buffer.
+ *
+ * The buffer holds the header, the vertex coordinates, the global vertex indices, the vertex
+ * indices of the edges and the edge indices of the triangles. Ints are stored in the bytes of
+ * the doubles, every section starts at a new double. Edges and triangles refer to the position
+ * of their elements in the buffer, such that the mesh can be appended to an existing mesh.
+ */
+std::vector<double> serializeMesh(const mesh::Mesh &mesh)
 {
-  PRECICE_TRACE(mesh.getName(), rankSender);
-  int dim = mesh.getDimensions();
+  const int    dim              = mesh.getDimensions();
+  const size_t numberOfVertices = mesh.vertices().size();
+  const size_t numberOfEdges    = mesh.edges().size();
+  // Triangles are only exchanged for 3D meshes
+  const size_t numberOfTriangles = (dim == 3) ? mesh.triangles().size() : 0;
 
-  int numberOfVertices = 0;
-  _communication->receive(numberOfVertices, rankSender);
-  PRECICE_DEBUG("Number of vertices to receive: {}", numberOfVertices);
+  std::vector<double> buffer(doublesForInts(headerSize) + numberOfVertices * dim + doublesForInts(numberOfVertices) +
+                             doublesForInts(2 * numberOfEdges) + doublesForInts(3 * numberOfTriangles));
+
+  double *position = putInts({dim, static_cast<int>(numberOfVertices), static_cast<int>(numberOfEdges), static_cast<int>(numberOfTriangles)},
+                             buffer.data());
 
-  std::vector<mesh::Vertex *> vertices;
-  vertices.reserve(numberOfVertices);
   if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int>    globalIDs;
-    _communication->receive(vertexCoords, rankSender);
-    _communication->receive(globalIDs, rankSender);
-    Eigen::VectorXd coords(dim);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      PRECICE_ASSERT(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
+    std::copy_n(mesh.vertexCoordinates().data(), numberOfVertices * dim, position);
+    position += numberOfVertices * dim;
   }
 
-  int numberOfEdges = 0;
-  _communication->receive(numberOfEdges, rankSender);
-  PRECICE_DEBUG("Number of edges to receive: {}", numberOfEdges);
-
-  boost::container::flat_map<int, mesh::Vertex *> vertexMap;
-  vertexMap.reserve(numberOfVertices);
-  std::vector<mesh::Edge *> edges;
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->receive(vertexIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
-
-    std::vector<int> edgeIDs;
-    _communication->receive(edgeIDs, rankSender);
-    for (int i = 0; i < numberOfEdges; i++) {
-      PRECICE_ASSERT(vertexMap.count((edgeIDs[i * 2])) == 1);
-      PRECICE_ASSERT(vertexMap.count(edgeIDs[i * 2 + 1]) == 1);
-      PRECICE_ASSERT(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
+  std::vector<int> globalIDs(numberOfVertices);
+  for (size_t i = 0; i < numberOfVertices; ++i) {
+    PRECICE_ASSERT(mesh.vertices()[i].getID() == static_cast<int>(i), mesh.vertices()[i].getID(), i);
+    globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
   }
-
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->receive(numberOfTriangles, rankSender);
-    PRECICE_DEBUG("Number of Triangles to receive: {}", numberOfTriangles);
-    PRECICE_DEBUG("Number of Edges: {}", edges.size());
-    if (numberOfTriangles > 0) {
-      PRECICE_ASSERT((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->receive(edgeIDs, rankSender);
-      boost::container::flat_map<int, mesh::Edge *> edgeMap;
-      edgeMap.reserve(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->receive(triangleIDs, rankSender);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        PRECICE_ASSERT(edgeMap.count(triangleIDs[i * 3]) == 1);
-        PRECICE_ASSERT(edgeMap.count(triangleIDs[i * 3 + 1]) == 1);
-        PRECICE_ASSERT(edgeMap.count(triangleIDs[i * 3 + 2]) == 1);
-        PRECICE_ASSERT(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        PRECICE_ASSERT(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        PRECICE_ASSERT(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
+  position = putInts(globalIDs, position);
+
+  // The ID of a vertex or edge is its position in the mesh
+  std::vector<int> edgeVertices(2 * numberOfEdges);
+  for (size_t i = 0; i < numberOfEdges; ++i) {
+    const mesh::Edge &edge = mesh.edges()[i];
+    PRECICE_ASSERT(edge.getID() == static_cast<int>(i), edge.getID(), i);
+    edgeVertices[2 * i]     = edge.vertex(0).getID();
+    edgeVertices[2 * i + 1] = edge.vertex(1).getID();
   }
+  position = putInts(edgeVertices, position);
+
+  std::vector<int> triangleEdges(3 * numberOfTriangles);
+  for (size_t i = 0; i < numberOfTriangles; ++i) {
+    const mesh::Triangle &triangle = mesh.triangles()[i];
+    triangleEdges[3 * i]           = triangle.edge(0).getID();
+    triangleEdges[3 * i + 1]       = triangle.edge(1).getID();
+    triangleEdges[3 * i + 2]       = triangle.edge(2).getID();
+  }
+  position = putInts(triangleEdges, position);
+
+  PRECICE_ASSERT(position == buffer.data() + buffer.size());
+  return buffer;
 }
 
-void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
+/// Appends the serialized mesh to the given mesh.
+void deserializeMesh(const std::vector<double> &buffer, mesh::Mesh &mesh)
 {
-  PRECICE_TRACE(mesh.getName());
-  int dim = mesh.getDimensions();
-
-  const auto &meshVertices     = mesh.vertices();
-  const int   numberOfVertices = meshVertices.size();
-  _communication->broadcast(numberOfVertices);
-  if (numberOfVertices > 0) {
-    std::vector<double> coords(static_cast<size_t>(numberOfVertices) * dim);
-    std::vector<int>    globalIDs(numberOfVertices);
-    for (size_t i = 0; i < static_cast<size_t>(numberOfVertices); ++i) {
-      std::copy_n(meshVertices[i].rawCoords().begin(), dim, &coords[i * dim]);
-      globalIDs[i] = meshVertices[i].getGlobalIndex();
-    }
-    _communication->broadcast(coords);
-    _communication->broadcast(globalIDs);
+  logging::Logger _log{"com::CommunicateMesh"};
+  PRECICE_ASSERT(buffer.size() >= doublesForInts(headerSize), buffer.size());
+
+  std::vector<int> header(headerSize);
+  const double *   position = getInts(buffer.data(), header);
+  const int        dim      = header[0];
+  PRECICE_ASSERT(dim == mesh.getDimensions(), dim, mesh.getDimensions());
+  const size_t numberOfVertices  = header[1];
+  const size_t numberOfEdges     = header[2];
+  const size_t numberOfTriangles = header[3];
+  PRECICE_DEBUG("Received {} vertices, {} edges and {} triangles", numberOfVertices, numberOfEdges, numberOfTriangles);
+  PRECICE_ASSERT(buffer.size() == doublesForInts(headerSize) + numberOfVertices * dim + doublesForInts(numberOfVertices) +
+                                      doublesForInts(2 * numberOfEdges) + doublesForInts(3 * numberOfTriangles),
+                 buffer.size());
+
+  // Elements of the buffer are appended to the existing ones
+  const size_t vertexOffset = mesh.vertices().size();
+  const size_t edgeOffset   = mesh.edges().size();
+  mesh.reserve(numberOfVertices, numberOfEdges);
+
+  const double *coordinates = position;
+  position += numberOfVertices * dim;
+  std::vector<int> globalIDs(numberOfVertices);
+  position = getInts(position, globalIDs);
+
+  Eigen::VectorXd coords(dim);
+  for (size_t i = 0; i < numberOfVertices; ++i) {
+    std::copy_n(coordinates + i * dim, dim, coords.data());
+    mesh::Vertex &v = mesh.createVertex(coords);
+    v.setGlobalIndex(globalIDs[i]);
   }
 
-  int numberOfEdges = mesh.edges().size();
-  _communication->broadcast(numberOfEdges);
-  if (numberOfEdges > 0) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = meshVertices[i].getID();
-    }
-    _communication->broadcast(vertexIDs);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    const auto &     meshEdges = mesh.edges();
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = meshEdges[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = meshEdges[i].vertex(1).getID();
-    }
-    _communication->broadcast(edgeIDs);
+  std::vector<int> edgeVertices(2 * numberOfEdges);
+  position = getInts(position, edgeVertices);
+  for (size_t i = 0; i < numberOfEdges; ++i) {
+    const size_t first  = edgeVertices[2 * i];
+    const size_t second = edgeVertices[2 * i + 1];
+    PRECICE_ASSERT(first < numberOfVertices, first, numberOfVertices);
+    PRECICE_ASSERT(second < numberOfVertices, second, numberOfVertices);
+    PRECICE_ASSERT(first != second);
+    mesh.createEdge(mesh.vertices()[vertexOffset + first], mesh.vertices()[vertexOffset + second]);
   }
 
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->broadcast(numberOfTriangles);
-    if (numberOfTriangles > 0) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->broadcast(edgeIDs);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      const auto &     meshTriangles = mesh.triangles();
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = meshTriangles[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = meshTriangles[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = meshTriangles[i].edge(2).getID();
-      }
-      _communication->broadcast(triangleIDs);
-    }
+  std::vector<int> triangleEdges(3 * numberOfTriangles);
+  getInts(position, triangleEdges);
+  for (size_t i = 0; i < numberOfTriangles; ++i) {
+    const size_t first  = triangleEdges[3 * i];
+    const size_t second = triangleEdges[3 * i + 1];
+    const size_t third  = triangleEdges[3 * i + 2];
+    PRECICE_ASSERT(first < numberOfEdges && second < numberOfEdges && third < numberOfEdges, first, second, third, numberOfEdges);
+    PRECICE_ASSERT(first != second && second != third && third != first);
+    mesh.createTriangle(mesh.edges()[edgeOffset + first], mesh.edges()[edgeOffset + second], mesh.edges()[edgeOffset + third]);
   }
 }
 
-void CommunicateMesh::broadcastReceiveMesh(
-    mesh::Mesh &mesh)
+/// A serialized mesh together with its size, kept alive until it has been sent
+struct SerializedMesh {
+  int                 size = 0;
+  std::vector<double> values;
+};
+
+} // namespace
+
+CommunicateMesh::CommunicateMesh(
+    com::PtrCommunication communication)
+    : _communication(std::move(communication))
 {
-  PRECICE_TRACE(mesh.getName());
-  int  dim             = mesh.getDimensions();
-  Rank rankBroadcaster = 0;
+}
 
-  std::vector<mesh::Vertex *>        vertices;
-  std::map<VertexID, mesh::Vertex *> vertexMap;
-  int                                numberOfVertices = 0;
-  _communication->broadcast(numberOfVertices, rankBroadcaster);
+void CommunicateMesh::sendMesh(
+    const mesh::Mesh &mesh,
+    int               rankReceiver)
+{
+  PRECICE_TRACE(mesh.getName(), rankReceiver);
+  aSendMesh(mesh, rankReceiver)->wait();
+}
 
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int>    globalIDs;
-    _communication->broadcast(vertexCoords, rankBroadcaster);
-    _communication->broadcast(globalIDs, rankBroadcaster);
-    Eigen::VectorXd coords(dim);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      PRECICE_ASSERT(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
-  }
+PtrRequest CommunicateMesh::aSendMesh(
+    const mesh::Mesh &mesh,
+    int               rankReceiver)
+{
+  PRECICE_TRACE(mesh.getName(), rankReceiver);
+  auto message    = std::make_shared<SerializedMesh>();
+  message->values = serializeMesh(mesh);
+  message->size   = message->values.size();
+
+  std::vector<PtrRequest> requests{_communication->aSend(message->size, rankReceiver),
+                                   _communication->aSend(message->values, rankReceiver)};
+  // The completion holds the message until both sends have completed
+  return std::make_shared<DeferredRequest>(std::move(requests), [message] {});
+}
 
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->broadcast(numberOfEdges, rankBroadcaster);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->broadcast(vertexIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
-
-    std::vector<int> edgeIDs;
-    _communication->broadcast(edgeIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfEdges; i++) {
-      PRECICE_ASSERT(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      PRECICE_ASSERT(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      PRECICE_ASSERT(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
-  }
+void CommunicateMesh::receiveMesh(
+    mesh::Mesh &mesh,
+    int         rankSender)
+{
+  PRECICE_TRACE(mesh.getName(), rankSender);
+  int size = 0;
+  _communication->receive(size, rankSender);
+  std::vector<double> buffer(size);
+  _communication->receive(precice::span<double>(buffer), rankSender);
+  deserializeMesh(buffer, mesh);
+}
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->broadcast(numberOfTriangles, rankBroadcaster);
-    if (numberOfTriangles > 0) {
-      PRECICE_ASSERT((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->broadcast(edgeIDs, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->broadcast(triangleIDs, rankBroadcaster);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        PRECICE_ASSERT(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        PRECICE_ASSERT(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        PRECICE_ASSERT(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        PRECICE_ASSERT(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        PRECICE_ASSERT(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        PRECICE_ASSERT(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
-  }
+void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
+{
+  PRECICE_TRACE(mesh.getName());
+  _communication->broadcast(serializeMesh(mesh));
+}
+
+void CommunicateMesh::broadcastReceiveMesh(
+    mesh::Mesh &mesh)
+{
+  PRECICE_TRACE(mesh.getName());
+  Rank                rankBroadcaster = 0;
+  std::vector<double> buffer;
+  _communication->broadcast(buffer, rankBroadcaster);
+  deserializeMesh(buffer, mesh);
 }
 
 } // namespace com
@@ -12,7 +12,11 @@ class Mesh;
 
 namespace com {
 
-/// Copies a Mesh object from a sender to a receiver.
+/**
+ * @brief Copies a Mesh object from a sender to a receiver.
+ *
+ * A mesh is transferred as a single message, which the receiver appends to its mesh in bulk.
+ */
 class CommunicateMesh {
 public:
   /// Constructor, takes communication to be used in transfer.
@@ -24,6 +28,17 @@ public:
       const mesh::Mesh &mesh,
       int               rankReceiver);
 
+  /**
+   * @brief Starts sending a constructed mesh to the receiver with given rank.
+   *
+   * The mesh is serialized into a single buffer, which is sent after its size.
+   * The returned request owns the buffer, hence the mesh may change before the request completed.
+   * No other messages may be sent to the receiver before the request completed.
+   */
+  PtrRequest aSendMesh(
+      const mesh::Mesh &mesh,
+      int               rankReceiver);
+
   /// Receives a mesh from the sender with given rank. Adds received mesh to mesh.
   void receiveMesh(
       mesh::Mesh &mesh,
@@ -11,6 +11,14 @@
 namespace precice {
 namespace com {
 
+namespace {
+/// Returns the lowest set bit of the rank, which bounds the distances to its children in the binomial tree
+int lowestBit(int rank)
+{
+  return rank & -rank;
+}
+} // namespace
+
 void Communication::connectMasterSlaves(std::string const &participantName,
                                         std::string const &tag,
                                         int                rank,
@@ -34,6 +42,111 @@ void Communication::connectMasterSlaves(std::string const &participantName,
     PRECICE_INFO("Connecting Slave #{} to Master", slaveRank);
     requestConnection(masterName, slaveName, tag, slaveRank, slavesSize);
   }
+
+  if (_useCollectiveTree && size > 2) {
+    connectCollectiveTree(participantName, tag, rank, size);
+  }
+}
+
+void Communication::connectCollectiveTree(std::string const &participantName,
+                                          std::string const &tag,
+                                          int                rank,
+                                          int                size)
+{
+  PRECICE_TRACE(rank, size);
+  PRECICE_ASSERT(not hasCollectiveTree());
+
+  // Rank r is the parent of the ranks r + 2^k with 2^k smaller than the lowest set bit of r.
+  // The master has no set bit, hence it is the parent of all ranks which are a power of two.
+  auto childDistanceLimit = [size](int parent) { return parent == 0 ? size : lowestBit(parent); };
+
+  const std::string childrenName = participantName + "TreeChildren";
+
+  if (rank != 0) {
+    const int parent   = rank & (rank - 1);
+    int       index    = 0;
+    int       siblings = 0;
+    for (int distance = 1; distance < childDistanceLimit(parent) && parent + distance < size; distance *= 2) {
+      if (parent + distance == rank) {
+        index = siblings;
+      }
+      ++siblings;
+    }
+    _treeParent = newTreeCommunication();
+    if (not _treeParent) {
+      return;
+    }
+    _treeParent->requestConnection(participantName + "Tree" + std::to_string(parent), childrenName, tag, index, siblings);
+  }
+
+  if (childDistanceLimit(rank) > 1 && rank + 1 < size) {
+    const std::string acceptorName = participantName + "Tree" + std::to_string(rank);
+    _treeChildren                  = newTreeCommunication();
+    if (not _treeChildren) {
+      return;
+    }
+    PRECICE_DEBUG("Connecting rank {} to its children in the collective tree", rank);
+    _treeChildren->prepareEstablishment(acceptorName, childrenName);
+    _treeChildren->acceptConnection(acceptorName, childrenName, tag, rank);
+    _treeChildren->cleanupEstablishment(acceptorName, childrenName);
+  }
+}
+
+void Communication::closeCollectiveTree()
+{
+  if (_treeParent) {
+    _treeParent->closeConnection();
+    _treeParent.reset();
+  }
+  if (_treeChildren) {
+    _treeChildren->closeConnection();
+    _treeChildren.reset();
+  }
+}
+
+template <typename T>
+void Communication::reduceSumOverTree(precice::span<T> items)
+{
+  if (_treeChildren) {
+    std::vector<T> received(items.size());
+    for (Rank child : _treeChildren->remoteCommunicatorRanks()) {
+      _treeChildren->receive(precice::span<T>{received}, child);
+      for (size_t i = 0; i < items.size(); i++) {
+        items[i] += received[i];
+      }
+    }
+  }
+  if (_treeParent) {
+    _treeParent->send(precice::span<const T>{items.data(), items.size()}, 0);
+  }
+}
+
+void Communication::reduceOverTree(precice::span<double> items, ReduceOperation const &operation)
+{
+  if (_treeChildren) {
+    std::vector<double> received(items.size());
+    for (Rank child : _treeChildren->remoteCommunicatorRanks()) {
+      _treeChildren->receive(precice::span<double>{received}, child);
+      operation(items, received);
+    }
+  }
+  if (_treeParent) {
+    _treeParent->send(precice::span<const double>{items.data(), items.size()}, 0);
+  }
+}
+
+template <typename T>
+void Communication::broadcastToTreeChildren(precice::span<const T> items)
+{
+  if (not _treeChildren) {
+    return;
+  }
+  std::vector<PtrRequest> requests;
+  requests.reserve(_treeChildren->getRemoteCommunicatorSize());
+  for (Rank child : _treeChildren->remoteCommunicatorRanks()) {
+    requests.push_back(_treeChildren->aSend(items, child));
+  }
+  Request::wait(requests);
 }
 
 /**
@@ -46,13 +159,23 @@ void Communication::reduceSum(precice::span<double const> itemsToSend, precice::
 
   std::copy(itemsToSend.begin(), itemsToSend.end(), itemsToReceive.begin());
 
-  std::vector<double> received(itemsToReceive.size());
+  if (hasCollectiveTree()) {
+    reduceSumOverTree(itemsToReceive);
+    return;
+  }
+
+  // post all receives first, such that the slaves do not wait for each other
+  std::vector<std::vector<double>> received(getRemoteCommunicatorSize(), std::vector<double>(itemsToReceive.size()));
+  std::vector<PtrRequest>          requests;
+  requests.reserve(getRemoteCommunicatorSize());
+  for (Rank rank : remoteCommunicatorRanks()) {
+    requests.push_back(aReceive(received[rank], rank + _rankOffset));
+  }
   // receive local results from slaves
   for (Rank rank : remoteCommunicatorRanks()) {
-    auto request = aReceive(received, rank + _rankOffset);
-    request->wait();
+    requests[rank]->wait();
     for (size_t i = 0; i < itemsToReceive.size(); i++) {
-      itemsToReceive[i] += received[i];
+      itemsToReceive[i] += received[rank][i];
     }
   }
 }
@@ -62,6 +185,13 @@ void Communication::reduceSum(precice::span<double const> itemsToSend, precice::
   PRECICE_TRACE(itemsToSend.size(), itemsToReceive.size());
   PRECICE_ASSERT(itemsToSend.size() == itemsToReceive.size());
 
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankMaster == 0, rankMaster);
+    std::vector<double> partialSum(itemsToSend.begin(), itemsToSend.end());
+    reduceSumOverTree(precice::span<double>{partialSum});
+    return;
+  }
+
   auto request = aSend(itemsToSend, rankMaster);
   request->wait();
 }
@@ -72,6 +202,11 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive)
 
   itemToReceive = itemToSend;
 
+  if (hasCollectiveTree()) {
+    reduceSumOverTree(precice::span<int>{&itemToReceive, 1});
+    return;
+  }
+
   // receive local results from slaves
   for (Rank rank : remoteCommunicatorRanks()) {
     auto request = aReceive(itemToSend, rank + _rankOffset);
@@ -84,6 +219,12 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive, Rank rankMaste
 {
   PRECICE_TRACE();
 
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankMaster == 0, rankMaster);
+    reduceSumOverTree(precice::span<int>{&itemToSend, 1});
+    return;
+  }
+
   auto request = aSend(itemToSend, rankMaster);
   request->wait();
 }
@@ -98,6 +239,11 @@ void Communication::allreduceSum(precice::span<double const> itemsToSend, precic
 
   reduceSum(itemsToSend, itemsToReceive);
 
+  if (hasCollectiveTree()) {
+    broadcastToTreeChildren(precice::span<const double>{itemsToReceive.data(), itemsToReceive.size()});
+    return;
+  }
+
   // send reduced result to all slaves
   std::vector<PtrRequest> requests;
   requests.reserve(getRemoteCommunicatorSize());
@@ -115,6 +261,15 @@ void Communication::allreduceSum(precice::span<double const> itemsToSend, precic
   PRECICE_TRACE(itemsToSend.size(), itemsToReceive.size());
   PRECICE_ASSERT(itemsToSend.size() == itemsToReceive.size());
 
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankMaster == 0, rankMaster);
+    std::copy(itemsToSend.begin(), itemsToSend.end(), itemsToReceive.begin());
+    reduceSumOverTree(itemsToReceive);
+    _treeParent->receive(itemsToReceive, 0);
+    broadcastToTreeChildren(precice::span<const double>{itemsToReceive.data(), itemsToReceive.size()});
+    return;
+  }
+
   reduceSum(itemsToSend, itemsToReceive, rankMaster);
   // receive reduced data from master
   receive(itemsToReceive, rankMaster + _rankOffset);
@@ -126,6 +281,12 @@ void Communication::allreduceSum(double itemToSend, double &itemToReceive)
 
   itemToReceive = itemToSend;
 
+  if (hasCollectiveTree()) {
+    reduceSumOverTree(precice::span<double>{&itemToReceive, 1});
+    broadcastToTreeChildren(precice::span<const double>{&itemToReceive, 1});
+    return;
+  }
+
   // receive local results from slaves
   for (Rank rank : remoteCommunicatorRanks()) {
     auto request = aReceive(itemToSend, rank + _rankOffset);
@@ -146,6 +307,14 @@ void Communication::allreduceSum(double itemToSend, double &itemsToReceive, Rank
 {
   PRECICE_TRACE();
 
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankMaster == 0, rankMaster);
+    reduceSumOverTree(precice::span<double>{&itemToSend, 1});
+    _treeParent->receive(itemsToReceive, 0);
+    broadcastToTreeChildren(precice::span<const double>{&itemsToReceive, 1});
+    return;
+  }
+
   auto request = aSend(itemToSend, rankMaster);
   request->wait();
   // receive reduced data from master
@@ -158,6 +327,12 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive)
 
   itemToReceive = itemToSend;
 
+  if (hasCollectiveTree()) {
+    reduceSumOverTree(precice::span<int>{&itemToReceive, 1});
+    broadcastToTreeChildren(precice::span<const int>{&itemToReceive, 1});
+    return;
+  }
+
   // receive local results from slaves
   for (Rank rank : remoteCommunicatorRanks()) {
     auto request = aReceive(itemToSend, rank + _rankOffset);
@@ -178,16 +353,70 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive, Rank rankMa
 {
   PRECICE_TRACE();
 
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankMaster == 0, rankMaster);
+    reduceSumOverTree(precice::span<int>{&itemToSend, 1});
+    _treeParent->receive(itemToReceive, 0);
+    broadcastToTreeChildren(precice::span<const int>{&itemToReceive, 1});
+    return;
+  }
+
   auto request = aSend(itemToSend, rankMaster);
   request->wait();
   // receive reduced data from master
   receive(itemToReceive, rankMaster + _rankOffset);
 }
 
+void Communication::allreduce(precice::span<double> items, ReduceOperation const &operation)
+{
+  PRECICE_TRACE(items.size());
+
+  if (hasCollectiveTree()) {
+    reduceOverTree(items, operation);
+    broadcastToTreeChildren(precice::span<const double>{items.data(), items.size()});
+    return;
+  }
+
+  std::vector<double> received(items.size());
+  for (Rank rank : remoteCommunicatorRanks()) {
+    receive(precice::span<double>{received}, rank + _rankOffset);
+    operation(items, received);
+  }
+
+  // send the result to all slaves
+  std::vector<PtrRequest> requests;
+  requests.reserve(getRemoteCommunicatorSize());
+  for (Rank rank : remoteCommunicatorRanks()) {
+    requests.push_back(aSend(precice::span<const double>{items.data(), items.size()}, rank + _rankOffset));
+  }
+  Request::wait(requests);
+}
+
+void Communication::allreduce(precice::span<double> items, ReduceOperation const &operation, Rank rankMaster)
+{
+  PRECICE_TRACE(items.size());
+
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankMaster == 0, rankMaster);
+    reduceOverTree(items, operation);
+    _treeParent->receive(items, 0);
+    broadcastToTreeChildren(precice::span<const double>{items.data(), items.size()});
+    return;
+  }
+
+  send(precice::span<const double>{items.data(), items.size()}, rankMaster);
+  receive(items, rankMaster + _rankOffset);
+}
+
 void Communication::broadcast(precice::span<const int> itemsToSend)
 {
   PRECICE_TRACE(itemsToSend.size());
 
+  if (hasCollectiveTree()) {
+    broadcastToTreeChildren(itemsToSend);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -202,6 +431,13 @@ void Communication::broadcast(precice::span<int> itemsToReceive, Rank rankBroadc
 {
   PRECICE_TRACE(itemsToReceive.size());
 
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    _treeParent->receive(itemsToReceive, 0);
+    broadcastToTreeChildren(precice::span<const int>{itemsToReceive.data(), itemsToReceive.size()});
+    return;
+  }
+
   receive(itemsToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -209,6 +445,11 @@ void Communication::broadcast(int itemToSend)
 {
   PRECICE_TRACE();
 
+  if (hasCollectiveTree()) {
+    broadcastToTreeChildren(precice::span<const int>{&itemToSend, 1});
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -222,6 +463,14 @@ void Communication::broadcast(int itemToSend)
 void Communication::broadcast(int &itemToReceive, Rank rankBroadcaster)
 {
   PRECICE_TRACE();
+
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    _treeParent->receive(itemToReceive, 0);
+    broadcastToTreeChildren(precice::span<const int>{&itemToReceive, 1});
+    return;
+  }
+
   receive(itemToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -229,6 +478,11 @@ void Communication::broadcast(precice::span<const double> itemsToSend)
 {
   PRECICE_TRACE(itemsToSend.size());
 
+  if (hasCollectiveTree()) {
+    broadcastToTreeChildren(itemsToSend);
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -243,6 +497,13 @@ void Communication::broadcast(precice::span<double> itemsToReceive,
                               int                   rankBroadcaster)
 {
   PRECICE_TRACE(itemsToReceive.size());
+
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    _treeParent->receive(itemsToReceive, 0);
+    broadcastToTreeChildren(precice::span<const double>{itemsToReceive.data(), itemsToReceive.size()});
+    return;
+  }
   receive(itemsToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -250,6 +511,11 @@ void Communication::broadcast(double itemToSend)
 {
   PRECICE_TRACE();
 
+  if (hasCollectiveTree()) {
+    broadcastToTreeChildren(precice::span<const double>{&itemToSend, 1});
+    return;
+  }
+
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
 
   for (Rank rank : remoteCommunicatorRanks()) {
@@ -263,6 +529,14 @@ void Communication::broadcast(double itemToSend)
 void Communication::broadcast(double &itemToReceive, Rank rankBroadcaster)
 {
   PRECICE_TRACE();
+
+  if (hasCollectiveTree()) {
+    PRECICE_ASSERT(rankBroadcaster == 0, rankBroadcaster);
+    _treeParent->receive(itemToReceive, 0);
+    broadcastToTreeChildren(precice::span<const double>{&itemToReceive, 1});
+    return;
+  }
+
   receive(itemToReceive, rankBroadcaster + _rankOffset);
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <set>
 #include <stddef.h>
 #include <string>
@@ -169,6 +170,11 @@ public:
                                          int                  requesterRank) = 0;
 
   /** Establishes the Master-Slave connection.
+   *
+   * For more than two ranks, the ranks are additionally connected in a binomial tree,
+   * if the communication supports it (see newTreeCommunication()). The collective
+   * operations then pass their data along the tree, which takes O(log size) steps
+   * instead of O(size) steps on the master.
    *
    * @param[in] participantName Name of the calling participant.
    * @param[in] tag Tag for establishing this connection
@@ -228,6 +234,22 @@ public:
   virtual void allreduceSum(int itemToSend, int &itemToReceive, Rank rankMaster);
   virtual void allreduceSum(int itemToSend, int &itemToReceive);
 
+  /// Merges the items received from another rank into the items of this rank, both of the same size
+  using ReduceOperation = std::function<void(precice::span<double> items, precice::span<const double> received)>;
+
+  /**
+   * @brief Reduces the items of all ranks by the given operation and distributes the result.
+   *
+   * The order in which the ranks are merged is unspecified, hence the operation has to be
+   * associative and commutative. The items pass along the collective tree, if available.
+   * To be called by the master, every other rank has to call allreduce(items, operation, rankMaster).
+   *
+   * @param[in,out] items the local items, which are replaced by the result
+   */
+  virtual void allreduce(precice::span<double> items, ReduceOperation const &operation);
+  /// Contributes the items to allreduce() of the master and replaces them by the result
+  virtual void allreduce(precice::span<double> items, ReduceOperation const &operation, Rank rankMaster);
+
   /// @}
 
   /// @name Broadcast
@@ -354,12 +376,48 @@ public:
 
   /// @}
 
+  /// @name Persistent requests
+  /// @{
+
+  /**
+   * @brief Creates an inactive request, which sends the items to the given rank whenever it is started.
+   *
+   * The request is started by Request::start() and completed by Request::wait(), as often as needed.
+   * The items have to stay valid for the lifetime of the request.
+   *
+   * @returns the request, or nullptr if the communication does not support persistent requests.
+   */
+  virtual PtrRequest sendInit(precice::span<const double> itemsToSend, Rank rankReceiver)
+  {
+    return nullptr;
+  }
+
+  /// Creates an inactive request, which receives the items from the given rank whenever it is started, see sendInit().
+  virtual PtrRequest receiveInit(precice::span<double> itemsToReceive, Rank rankSender)
+  {
+    return nullptr;
+  }
+
+  /// @}
+
   /// Set rank offset.
   void setRankOffset(Rank rankOffset)
   {
     _rankOffset = rankOffset;
   }
 
+  /// Enables or disables the collective tree, has to be set before connectMasterSlaves()
+  void setUseCollectiveTree(bool useCollectiveTree)
+  {
+    _useCollectiveTree = useCollectiveTree;
+  }
+
+  /// Returns true, if the collective operations pass their data along the collective tree
+  bool hasCollectiveTree() const
+  {
+    return _treeParent || _treeChildren;
+  }
+
 protected:
   /// Rank offset for masters-slave communication, since ranks are from 0 to size-2
   int _rankOffset = 0;
@@ -369,8 +427,47 @@ protected:
   /// Adjusts the given rank bases on the _rankOffset
   virtual int adjustRank(Rank rank) const;
 
+  /**
+   * @brief Creates an unconnected communication of the same kind, used for the links of the collective tree.
+   *
+   * Communications returning nullptr, e.g. those implementing the collective operations natively,
+   * keep using the master-slave connection for the collective operations.
+   */
+  virtual PtrCommunication newTreeCommunication() const
+  {
+    return nullptr;
+  }
+
+  /// Closes the links of the collective tree, to be called by closeConnection()
+  void closeCollectiveTree();
+
 private:
   logging::Logger _log{"com::Communication"};
+
+  bool _useCollectiveTree = true;
+
+  /// Connection to the parent in the collective tree, empty on the master
+  PtrCommunication _treeParent;
+
+  /// Connection to the children in the collective tree, empty on leaves
+  PtrCommunication _treeChildren;
+
+  /// Connects all ranks of the participant in a binomial tree rooted at the master
+  void connectCollectiveTree(std::string const &participantName,
+                             std::string const &tag,
+                             int                rank,
+                             int                size);
+
+  /// Sums up the items of the subtree of this rank and passes them on to the parent
+  template <typename T>
+  void reduceSumOverTree(precice::span<T> items);
+
+  /// Merges the items of the subtree of this rank and passes them on to the parent
+  void reduceOverTree(precice::span<double> items, ReduceOperation const &operation);
+
+  /// Passes the items on to the children in the collective tree
+  template <typename T>
+  void broadcastToTreeChildren(precice::span<const T> items);
 };
 } // namespace com
 } // namespace precice
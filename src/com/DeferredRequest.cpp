@@ -0,0 +1,39 @@
+#include "DeferredRequest.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace precice {
+namespace com {
+DeferredRequest::DeferredRequest(std::vector<PtrRequest> requests, std::function<void()> completion)
+    : _requests(std::move(requests)),
+      _completion(std::move(completion))
+{
+}
+
+bool DeferredRequest::test()
+{
+  if (not std::all_of(_requests.begin(), _requests.end(), [](const PtrRequest &request) { return request->test(); })) {
+    return false;
+  }
+  complete();
+  return true;
+}
+
+void DeferredRequest::wait()
+{
+  Request::wait(_requests);
+  complete();
+}
+
+void DeferredRequest::complete()
+{
+  _requests.clear();
+  if (_completion) {
+    // Reset before running, such that the completion runs only once
+    auto completion = std::move(_completion);
+    _completion     = nullptr;
+    completion();
+  }
+}
+} // namespace com
+} // namespace precice
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "Request.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice {
+namespace com {
+/**
+ * @brief Request which completes a set of requests and then runs a completion function.
+ *
+ * Used to post composed operations, e.g. receives from several ranks whose values are
+ * processed afterwards. The completion function runs exactly once, within test() or wait().
+ */
+class DeferredRequest : public Request {
+public:
+  DeferredRequest(std::vector<PtrRequest> requests, std::function<void()> completion);
+
+  bool test() override;
+
+  void wait() override;
+
+private:
+  std::vector<PtrRequest> _requests;
+
+  std::function<void()> _completion;
+
+  void complete();
+};
+} // namespace com
+} // namespace precice
@@ -369,6 +369,40 @@ PtrRequest MPICommunication::aReceive(bool &itemToReceive, Rank rankSender)
   return PtrRequest(new MPIRequest(request));
 }
 
+PtrRequest MPICommunication::sendInit(precice::span<const double> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+
+  MPI_Request request;
+  MPI_Send_init(const_cast<double *>(itemsToSend.data()),
+                itemsToSend.size(),
+                MPI_DOUBLE,
+                rank(rankReceiver),
+                0,
+                communicator(rankReceiver),
+                &request);
+
+  return PtrRequest(new MPIRequest(request, true));
+}
+
+PtrRequest MPICommunication::receiveInit(precice::span<double> itemsToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  rankSender = adjustRank(rankSender);
+
+  MPI_Request request;
+  MPI_Recv_init(itemsToReceive.data(),
+                itemsToReceive.size(),
+                MPI_DOUBLE,
+                rank(rankSender),
+                0,
+                communicator(rankSender),
+                &request);
+
+  return PtrRequest(new MPIRequest(request, true));
+}
+
 void MPICommunication::send(std::vector<int> const &v, Rank rankReceiver)
 {
   PRECICE_TRACE(rankReceiver);
@@ -135,6 +135,12 @@ public:
   void send(std::vector<double> const &v, Rank rankReceiver) override;
   void receive(std::vector<double> &v, Rank rankSender) override;
 
+  /// Creates a persistent send request by MPI_Send_init.
+  PtrRequest sendInit(precice::span<const double> itemsToSend, Rank rankReceiver) override;
+
+  /// Creates a persistent receive request by MPI_Recv_init.
+  PtrRequest receiveInit(precice::span<double> itemsToReceive, Rank rankSender) override;
+
 protected:
   /// Returns the communicator.
   virtual MPI_Comm &communicator(Rank rank) = 0;
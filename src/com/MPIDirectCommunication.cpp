@@ -2,6 +2,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include <memory>
+#include <vector>
 
 #include "MPIDirectCommunication.hpp"
 #include "logging/LogMacros.hpp"
@@ -144,6 +145,27 @@ void MPIDirectCommunication::allreduceSum(int itemToSend, int &itemToReceive, Ra
   MPI_Allreduce(&itemToSend, &itemToReceive, 1, MPI_INT, MPI_SUM, _commState->comm);
 }
 
+void MPIDirectCommunication::allreduce(precice::span<double> items, ReduceOperation const &operation)
+{
+  PRECICE_TRACE(items.size());
+  // The master gathers the items of all ranks, merges them in the order of the ranks and broadcasts the result
+  int size = 0;
+  MPI_Comm_size(_commState->comm, &size);
+  std::vector<double> gathered(items.size() * size);
+  MPI_Gather(items.data(), items.size(), MPI_DOUBLE, gathered.data(), items.size(), MPI_DOUBLE, 0, _commState->comm);
+  for (int rank = 1; rank < size; ++rank) {
+    operation(items, precice::span<const double>{gathered.data() + rank * items.size(), items.size()});
+  }
+  MPI_Bcast(items.data(), items.size(), MPI_DOUBLE, 0, _commState->comm);
+}
+
+void MPIDirectCommunication::allreduce(precice::span<double> items, ReduceOperation const &, Rank rankMaster)
+{
+  PRECICE_TRACE(items.size());
+  MPI_Gather(items.data(), items.size(), MPI_DOUBLE, nullptr, 0, MPI_DOUBLE, rankMaster, _commState->comm);
+  MPI_Bcast(items.data(), items.size(), MPI_DOUBLE, rankMaster, _commState->comm);
+}
+
 void MPIDirectCommunication::broadcast(precice::span<const int> itemsToSend)
 {
   PRECICE_TRACE(itemsToSend.size());
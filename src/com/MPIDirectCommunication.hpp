@@ -102,6 +102,10 @@ public:
 
   virtual void allreduceSum(int itemToSend, int &itemsToReceive) override;
 
+  virtual void allreduce(precice::span<double> items, ReduceOperation const &operation) override;
+
+  virtual void allreduce(precice::span<double> items, ReduceOperation const &operation, Rank rankMaster) override;
+
   virtual void broadcast(precice::span<const int> itemsToSend) override;
 
   virtual void broadcast(precice::span<int> itemsToReceive, Rank rankBroadcaster) override;
@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include <boost/filesystem.hpp>
+#include <memory>
 #include <ostream>
 #include <utility>
 
@@ -207,6 +208,8 @@ void MPIPortsCommunication::closeConnection()
   if (not isConnected())
     return;
 
+  closeCollectiveTree();
+
   for (auto &communicator : _communicators) {
     MPI_Comm_disconnect(&communicator.second);
   }
@@ -217,6 +220,11 @@ void MPIPortsCommunication::closeConnection()
   _isConnected = false;
 }
 
+PtrCommunication MPIPortsCommunication::newTreeCommunication() const
+{
+  return std::make_shared<MPIPortsCommunication>(_addressDirectory);
+}
+
 void MPIPortsCommunication::prepareEstablishment(std::string const &acceptorName,
                                                  std::string const &requesterName)
 {
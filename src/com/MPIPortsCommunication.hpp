@@ -59,6 +59,9 @@ public:
   virtual void cleanupEstablishment(std::string const &acceptorName,
                                     std::string const &requesterName) override;
 
+protected:
+  virtual PtrCommunication newTreeCommunication() const override;
+
 private:
   virtual MPI_Comm &communicator(Rank rank) override;
 
@@ -1,14 +1,24 @@
 #ifndef PRECICE_NO_MPI
 
 #include "MPIRequest.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace com {
-MPIRequest::MPIRequest(MPI_Request request)
-    : _request(request)
+MPIRequest::MPIRequest(MPI_Request request, bool persistent)
+    : _request(request),
+      _persistent(persistent)
 {
 }
 
+MPIRequest::~MPIRequest()
+{
+  if (_persistent && _request != MPI_REQUEST_NULL) {
+    MPI_Wait(&_request, MPI_STATUS_IGNORE);
+    MPI_Request_free(&_request);
+  }
+}
+
 bool MPIRequest::test()
 {
   int complete = 0;
@@ -22,6 +32,12 @@ void MPIRequest::wait()
 {
   MPI_Wait(&_request, MPI_STATUS_IGNORE);
 }
+
+void MPIRequest::start()
+{
+  PRECICE_ASSERT(_persistent, "Only persistent requests can be started.");
+  MPI_Start(&_request);
+}
 } // namespace com
 } // namespace precice
 
@@ -8,14 +8,21 @@ namespace precice {
 namespace com {
 class MPIRequest : public Request {
 public:
-  explicit MPIRequest(MPI_Request request);
+  /// Wraps the request, persistent requests are freed on destruction
+  explicit MPIRequest(MPI_Request request, bool persistent = false);
+
+  ~MPIRequest() override;
 
   bool test() override;
 
   void wait() override;
 
+  void start() override;
+
 private:
   MPI_Request _request;
+
+  bool _persistent;
 };
 } // namespace com
 } // namespace precice
@@ -1,5 +1,6 @@
 #include "Request.hpp"
 #include <memory>
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace com {
@@ -12,5 +13,10 @@ void Request::wait(std::vector<PtrRequest> &requests)
 }
 
 Request::~Request() = default;
+
+void Request::start()
+{
+  PRECICE_ASSERT(false, "Only persistent requests can be started.");
+}
 } // namespace com
 } // namespace precice
@@ -15,6 +15,9 @@ public:
   virtual bool test() = 0;
 
   virtual void wait() = 0;
+
+  /// Starts a persistent request again, see Communication::sendInit()
+  virtual void start();
 };
 } // namespace com
 } // namespace precice
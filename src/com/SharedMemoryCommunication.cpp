@@ -0,0 +1,555 @@
+#include <atomic>
+#include <boost/filesystem.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#include "ConnectionInfoPublisher.hpp"
+#include "SharedMemoryCommunication.hpp"
+#include "SharedMemoryRequest.hpp"
+#include "logging/LogMacros.hpp"
+#include "precice/types.hpp"
+#include "utils/assertion.hpp"
+#include "utils/span_tools.hpp"
+
+namespace precice {
+namespace com {
+
+namespace {
+
+/// Marks a completely initialized listener
+constexpr uint32_t listenerMagic = 0x6c697374;
+
+/**
+ * @brief Shared memory segment, in which the requesters register their ranks at the acceptor.
+ *
+ * The slots hold the rank plus one, such that the zero-initialized memory denotes free slots.
+ * Only the touched pages of the segment are actually allocated.
+ */
+class Listener {
+public:
+  static constexpr int maxRequesters = 1 << 16;
+
+  /**
+   * @brief Creates the listener segment, if this is the acceptor, or opens it otherwise.
+   *
+   * The acceptor creates the segment before it publishes its name, hence it exists when the requesters open it.
+   */
+  Listener(std::string name, bool isAcceptor)
+      : _name(std::move(name)), _isAcceptor(isAcceptor)
+  {
+    if (_isAcceptor) {
+      const int fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+      PRECICE_CHECK(fd != -1, "Creating the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+      PRECICE_CHECK(ftruncate(fd, sizeof(Segment)) == 0, "Resizing the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+      map(fd);
+      new (_segment) Segment();
+      _segment->magic.store(listenerMagic, std::memory_order_release);
+    } else {
+      const int fd = shm_open(_name.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+      PRECICE_CHECK(fd != -1, "Opening the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+      map(fd);
+      PRECICE_ASSERT(_segment->magic.load(std::memory_order_acquire) == listenerMagic);
+    }
+  }
+
+  ~Listener()
+  {
+    munmap(_segment, sizeof(Segment));
+    if (_isAcceptor) {
+      shm_unlink(_name.c_str());
+    }
+  }
+
+  Listener(Listener const &) = delete;
+  Listener &operator=(Listener const &) = delete;
+
+  /// Registers the rank of a requester, whose link has already been created
+  void registerRequester(int rank)
+  {
+    const int slot = _segment->registered.fetch_add(1);
+    PRECICE_CHECK(slot < maxRequesters, "A shared memory communication supports at most {} connected ranks.", maxRequesters);
+    _segment->slots[slot].store(rank + 1, std::memory_order_release);
+  }
+
+  /// Blocks until the given count of requesters has registered, returns the rank of the last one
+  int waitForRequester(int count)
+  {
+    PRECICE_ASSERT(count < maxRequesters);
+    int rankPlusOne = 0;
+    while ((rankPlusOne = _segment->slots[count].load(std::memory_order_acquire)) == 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return rankPlusOne - 1;
+  }
+
+private:
+  struct Segment {
+    std::atomic<uint32_t> magic;
+    std::atomic<int>      registered;
+    std::atomic<int>      slots[maxRequesters];
+  };
+
+  void map(int fd)
+  {
+    void *mapping = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    PRECICE_CHECK(mapping != MAP_FAILED, "Mapping the shared memory segment \"{}\" failed with the system error: {}", _name, std::strerror(errno));
+    _segment = static_cast<Segment *>(mapping);
+  }
+
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  std::string _name;
+  bool        _isAcceptor;
+  Segment *   _segment = nullptr;
+};
+
+std::string hostName()
+{
+  char name[256] = {};
+  gethostname(name, sizeof(name) - 1);
+  return name;
+}
+
+} // namespace
+
+SharedMemoryCommunication::SharedMemoryCommunication(std::string addressDirectory, size_t bufferSize)
+    : _addressDirectory(std::move(addressDirectory)),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  PRECICE_TRACE(_isConnected);
+  closeConnection();
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(isConnected());
+  return _links.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 std::string const &tag,
+                                                 int                acceptorRank,
+                                                 int                rankOffset)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  setRankOffset(rankOffset);
+
+  const std::string address = createAddress();
+  const std::string name    = segmentName(address);
+  Listener          listener(name, true);
+
+  ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  conInfo.write(address);
+  PRECICE_DEBUG("Accept connection at {}", address);
+
+  int peerCurrent               = 0;  // Current peer to connect to
+  int peerCount                 = -1; // The total count of peers (initialized in the first iteration)
+  int requesterCommunicatorSize = -1;
+
+  do {
+    const int requesterRank = listener.waitForRequester(peerCurrent);
+    PRECICE_ASSERT(_links.count(requesterRank) == 0,
+                   "Rank {} has already been connected. Duplicate requests are not allowed.", requesterRank);
+    _links[requesterRank] = SharedMemoryLink::open(name + "-" + std::to_string(requesterRank));
+    PRECICE_DEBUG("Accepted connection at {}", address);
+    _isConnected = true;
+
+    // send and receive expect a rank from the acceptor perspective.
+    // Thus we need to apply given rankOffset before passing it to send/receive.
+    auto adjustedRequesterRank = requesterRank + rankOffset;
+    send(acceptorRank, adjustedRequesterRank);
+    receive(requesterCommunicatorSize, adjustedRequesterRank);
+
+    // Initialize the count of peers to connect to
+    if (peerCurrent == 0) {
+      peerCount = requesterCommunicatorSize;
+    }
+
+    PRECICE_ASSERT(requesterCommunicatorSize > 0,
+                   "Requester communicator size is {} which is invalid.", requesterCommunicatorSize);
+    PRECICE_ASSERT(requesterCommunicatorSize == peerCount,
+                   "Current requester size from rank {} is {} but should be {}", requesterRank, requesterCommunicatorSize, peerCount);
+  } while (++peerCurrent < requesterCommunicatorSize);
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         std::string const &tag,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  PRECICE_ASSERT(requesterCommunicatorSize >= 0, "Requester communicator size has to be positve.");
+  PRECICE_ASSERT(not isConnected());
+
+  if (requesterCommunicatorSize == 0) {
+    PRECICE_DEBUG("Accepting no connections.");
+    _isConnected = true;
+    return;
+  }
+
+  const std::string address = createAddress();
+  const std::string name    = segmentName(address);
+  Listener          listener(name, true);
+
+  ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+  conInfo.write(address);
+  PRECICE_DEBUG("Accepting connection at {}", address);
+
+  for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
+    const int requesterRank = listener.waitForRequester(connection);
+    _links[requesterRank]   = SharedMemoryLink::open(name + "-" + std::to_string(requesterRank));
+    PRECICE_DEBUG("Accepted connection at {}", address);
+  }
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  std::string const &tag,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  ConnectionInfoReader conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  std::string const    address = conInfo.read();
+  std::string const    name    = segmentName(address);
+  PRECICE_DEBUG("Request connection to {}", address);
+
+  _links[0] = SharedMemoryLink::create(name + "-" + std::to_string(requesterRank), _bufferSize);
+  Listener(name, false).registerRequester(requesterRank);
+  _isConnected = true;
+  PRECICE_DEBUG("Requested connection to {}", address);
+
+  int acceptorRank = -1;
+  receive(acceptorRank, 0);
+  send(requesterCommunicatorSize, 0);
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string const &  acceptorName,
+                                                          std::string const &  requesterName,
+                                                          std::string const &  tag,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  PRECICE_ASSERT(not isConnected());
+
+  for (auto const &acceptorRank : acceptorRanks) {
+    ConnectionInfoReader conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+    std::string const    address = conInfo.read();
+    std::string const    name    = segmentName(address);
+    PRECICE_DEBUG("Requesting connection to {}", address);
+
+    _links[acceptorRank] = SharedMemoryLink::create(name + "-" + std::to_string(requesterRank), _bufferSize);
+    Listener(name, false).registerRequester(requesterRank);
+    PRECICE_DEBUG("Requested connection to {}, rank = {}", address, acceptorRank);
+  }
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  PRECICE_TRACE();
+
+  if (not isConnected())
+    return;
+
+  closeCollectiveTree();
+
+  // Pending writes have to be completed, as there is no background progress
+  for (auto &link : _links) {
+    link.second->flush();
+  }
+  _links.clear();
+
+  _isConnected = false;
+}
+
+void SharedMemoryCommunication::prepareEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace boost::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Creating connection exchange directory {}", dir);
+  try {
+    create_directories(dir);
+  } catch (const boost::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Creating directory for connection info failed with filesystem error: {}", e.what());
+  }
+}
+
+void SharedMemoryCommunication::cleanupEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace boost::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Removing connection exchange directory {}", dir);
+  try {
+    remove_all(dir);
+  } catch (const boost::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Cleaning up connection info failed with filesystem error {}", e.what());
+  }
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  size_t size = itemToSend.size() + 1;
+  write(&size, sizeof(size_t), rankReceiver);
+  write(itemToSend.c_str(), size, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(precice::span<const int> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  write(itemsToSend.data(), itemsToSend.size() * sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(precice::span<const int> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  return aWrite(itemsToSend.data(), itemsToSend.size() * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(precice::span<const double> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  write(itemsToSend.data(), itemsToSend.size() * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(precice::span<const double> itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankReceiver);
+  return aWrite(itemsToSend.data(), itemsToSend.size() * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<double> const &itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aWrite(itemsToSend.data(), itemsToSend.size() * sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(double itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  write(&itemToSend, sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, Rank rankReceiver)
+{
+  return aSend(precice::refToSpan<const double>(itemToSend), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  write(&itemToSend, sizeof(int), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, Rank rankReceiver)
+{
+  return aSend(precice::refToSpan<const int>(itemToSend), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<int> const &itemsToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aWrite(itemsToSend.data(), itemsToSend.size() * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  write(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, Rank rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  return aWrite(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  size_t size = 0;
+  read(&size, sizeof(size_t), rankSender);
+  std::vector<char> msg(size);
+  read(msg.data(), size, rankSender);
+  itemToReceive = msg.data();
+}
+
+void SharedMemoryCommunication::receive(precice::span<int> itemsToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  read(itemsToReceive.data(), itemsToReceive.size() * sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(precice::span<double> itemsToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  read(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(precice::span<double> itemsToReceive,
+                                               int                   rankSender)
+{
+  PRECICE_TRACE(itemsToReceive.size(), rankSender);
+  return aRead(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(std::vector<double> &itemsToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aRead(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  read(&itemToReceive, sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, Rank rankSender)
+{
+  return aReceive(precice::refToSpan<double>(itemToReceive), rankSender);
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  read(&itemToReceive, sizeof(int), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aRead(&itemToReceive, sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  read(&itemToReceive, sizeof(bool), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  return aRead(&itemToReceive, sizeof(bool), rankSender);
+}
+
+void SharedMemoryCommunication::send(std::vector<int> const &v, Rank rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  size_t size = v.size();
+  write(&size, sizeof(size_t), rankReceiver);
+  write(v.data(), size * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::vector<int> &v, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  size_t size = 0;
+  read(&size, sizeof(size_t), rankSender);
+  v.resize(size);
+  read(v.data(), size * sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::send(std::vector<double> const &v, Rank rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  size_t size = v.size();
+  write(&size, sizeof(size_t), rankReceiver);
+  write(v.data(), size * sizeof(double), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::vector<double> &v, Rank rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  size_t size = 0;
+  read(&size, sizeof(size_t), rankSender);
+  v.resize(size);
+  read(v.data(), size * sizeof(double), rankSender);
+}
+
+PtrCommunication SharedMemoryCommunication::newTreeCommunication() const
+{
+  return std::make_shared<SharedMemoryCommunication>(_addressDirectory, _bufferSize);
+}
+
+std::shared_ptr<SharedMemoryLink> const &SharedMemoryCommunication::link(Rank rank)
+{
+  rank = adjustRank(rank);
+  PRECICE_ASSERT(rank >= 0, rank);
+  PRECICE_ASSERT(isConnected());
+  PRECICE_ASSERT(_links.count(rank) == 1, "There is no connection to rank {}.", rank);
+  return _links[rank];
+}
+
+void SharedMemoryCommunication::write(void const *data, size_t size, Rank rankReceiver)
+{
+  link(rankReceiver)->write(data, size);
+}
+
+void SharedMemoryCommunication::read(void *data, size_t size, Rank rankSender)
+{
+  link(rankSender)->read(data, size);
+}
+
+PtrRequest SharedMemoryCommunication::aWrite(void const *data, size_t size, Rank rankReceiver)
+{
+  auto const &target = link(rankReceiver);
+  return PtrRequest(new SharedMemoryRequest(target, target->asyncWrite(data, size)));
+}
+
+PtrRequest SharedMemoryCommunication::aRead(void *data, size_t size, Rank rankSender)
+{
+  auto const &source = link(rankSender);
+  return PtrRequest(new SharedMemoryRequest(source, source->asyncRead(data, size)));
+}
+
+std::string SharedMemoryCommunication::createAddress()
+{
+  // Unique among all communications of this host, the host name allows to detect remote peers
+  static std::atomic<int> counter{0};
+  return hostName() + ":/precice-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+}
+
+std::string SharedMemoryCommunication::segmentName(std::string const &address)
+{
+  auto const        sepidx = address.rfind(':');
+  std::string const host   = address.substr(0, sepidx);
+  PRECICE_CHECK(host == hostName(),
+                "A shared memory communication can only connect processes on the same host, "
+                "but \"{}\" tries to connect to \"{}\". Please switch to a \"sockets\" or \"mpi\" communication.",
+                hostName(), host);
+  return address.substr(sepidx + 1);
+}
+
+} // namespace com
+} // namespace precice
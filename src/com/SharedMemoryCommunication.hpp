@@ -0,0 +1,186 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "com/Communication.hpp"
+#include "com/SharedMemoryLink.hpp"
+#include "com/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include "precice/types.hpp"
+
+namespace precice {
+namespace com {
+/**
+ * @brief Implements Communication by using POSIX shared memory.
+ *
+ * Requires all connected processes to run on the same node, which is checked during the connection build-up.
+ * Every pair of connected ranks shares a SharedMemoryLink with one ring buffer per direction.
+ *
+ * The acceptor creates a listener segment and publishes its name using the ConnectionInfoWriter.
+ * Each requester creates its link and registers its rank in the listener, upon which the acceptor opens the link.
+ *
+ * There is no background thread, asynchronous operations advance whenever the link they belong to is used.
+ */
+class SharedMemoryCommunication : public Communication {
+public:
+  /// Default capacity of the ring buffers in bytes
+  static constexpr size_t defaultBufferSize = 1 << 20;
+
+  explicit SharedMemoryCommunication(std::string addressDirectory = ".",
+                                     size_t      bufferSize       = defaultBufferSize);
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual size_t getRemoteCommunicatorSize() override;
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                std::string const &tag,
+                                int                acceptorRank,
+                                int                rankOffset = 0) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        std::string const &tag,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 std::string const &tag,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string const &  acceptorName,
+                                         std::string const &  requesterName,
+                                         std::string const &  tag,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, Rank rankReceiver) override;
+
+  /// Sends an array of integer values.
+  virtual void send(precice::span<const int> itemsToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(precice::span<const int> itemsToSend, Rank rankReceiver) override;
+
+  /// Sends an array of double values.
+  virtual void send(precice::span<const double> itemsToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(precice::span<const double> itemsToSend, Rank rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<double> const &itemsToSend, Rank rankReceiver) override;
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(const double &itemToSend, Rank rankReceiver) override;
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(const int &itemToSend, Rank rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<int> const &itemsToSend, int rankReceiver) override;
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, Rank rankReceiver) override;
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(const bool &itemToSend, Rank rankReceiver) override;
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, Rank rankSender) override;
+
+  /// Receives an array of integer values.
+  virtual void receive(precice::span<int> itemsToReceive, Rank rankSender) override;
+
+  /// Receives an array of double values.
+  virtual void receive(precice::span<double> itemsToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(precice::span<double> itemsToReceive,
+                              int                   rankSender) override;
+
+  virtual PtrRequest aReceive(std::vector<double> &itemsToReceive, Rank rankSender) override;
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double &itemToReceive, Rank rankSender) override;
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int &itemToReceive, Rank rankSender) override;
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, Rank rankSender) override;
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool &itemToReceive, Rank rankSender) override;
+
+  void send(std::vector<int> const &v, Rank rankReceiver) override;
+  void receive(std::vector<int> &v, Rank rankSender) override;
+
+  void send(std::vector<double> const &v, Rank rankReceiver) override;
+  void receive(std::vector<double> &v, Rank rankSender) override;
+
+  virtual void prepareEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+  virtual void cleanupEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+protected:
+  virtual PtrCommunication newTreeCommunication() const override;
+
+private:
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  /// Directory where the names of the listeners are exchanged by file.
+  std::string _addressDirectory;
+
+  /// Capacity of the ring buffers of the created links in bytes.
+  size_t _bufferSize;
+
+  /// Remote rank -> link map
+  std::map<int, std::shared_ptr<SharedMemoryLink>> _links;
+
+  /// Returns the link to the given rank, which is adjusted by the rank offset
+  std::shared_ptr<SharedMemoryLink> const &link(Rank rank);
+
+  /// Writes the bytes to the given rank
+  void write(void const *data, size_t size, Rank rankReceiver);
+
+  /// Reads the bytes from the given rank
+  void read(void *data, size_t size, Rank rankSender);
+
+  /// Starts writing the bytes to the given rank
+  PtrRequest aWrite(void const *data, size_t size, Rank rankReceiver);
+
+  /// Starts reading the bytes from the given rank
+  PtrRequest aRead(void *data, size_t size, Rank rankSender);
+
+  /// Returns the address of a new listener, consisting of the host name and a unique segment name
+  std::string createAddress();
+
+  /// Returns the segment name of the address and checks that the address belongs to this host
+  std::string segmentName(std::string const &address);
+};
+} // namespace com
+} // namespace precice
@@ -0,0 +1,325 @@
+#include "SharedMemoryLink.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace com {
+
+namespace {
+
+/// Marks a completely initialized segment
+constexpr uint32_t segmentMagic = 0x70726563;
+
+/// Number of unsuccessful attempts to make progress before a waiting process goes to sleep
+constexpr int spinAttempts = 100;
+
+/// An atomic value on its own cache line, such that the two sides do not interfere
+template <typename T>
+struct alignas(64) Padded {
+  std::atomic<T> value;
+};
+
+#ifdef __linux__
+void futexWait(std::atomic<uint32_t> &word, uint32_t expected)
+{
+  // The timeout only guards against a lost wake-up, e.g. if the peer died
+  timespec timeout{0, 1000000};
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t> &word)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+#endif
+
+} // namespace
+
+/// Layout of the shared memory, which is followed by the ring buffers of both sides
+struct SharedMemoryLink::Segment {
+  Padded<uint32_t> magic;
+  Padded<uint64_t> capacity;
+
+  /// Incremented by the peer whenever it changed the link
+  Padded<uint32_t> doorbell[2];
+  /// Whether the side is sleeping on its doorbell
+  Padded<uint32_t> sleeping[2];
+
+  /// Bytes written to the ring buffer of a side
+  Padded<uint64_t> written[2];
+  /// Bytes read by the peer from the ring buffer of a side
+  Padded<uint64_t> read[2];
+
+  char *ring(int side)
+  {
+    return reinterpret_cast<char *>(this + 1) + side * capacity.value.load(std::memory_order_relaxed);
+  }
+};
+
+std::shared_ptr<SharedMemoryLink> SharedMemoryLink::create(std::string const &name, size_t capacity)
+{
+  logging::Logger _log{"com::SharedMemoryLink"};
+  PRECICE_TRACE(name, capacity);
+
+  const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  PRECICE_CHECK(fd != -1, "Creating the shared memory segment \"{}\" failed with the system error: {}", name, std::strerror(errno));
+
+  const size_t size = sizeof(Segment) + 2 * capacity;
+  PRECICE_CHECK(ftruncate(fd, size) == 0, "Resizing the shared memory segment \"{}\" failed with the system error: {}", name, std::strerror(errno));
+  void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  PRECICE_CHECK(mapping != MAP_FAILED, "Mapping the shared memory segment \"{}\" failed with the system error: {}", name, std::strerror(errno));
+
+  auto segment = new (mapping) Segment();
+  segment->capacity.value.store(capacity, std::memory_order_relaxed);
+  segment->magic.value.store(segmentMagic, std::memory_order_release);
+
+  return std::shared_ptr<SharedMemoryLink>(new SharedMemoryLink(mapping, size, 1));
+}
+
+std::shared_ptr<SharedMemoryLink> SharedMemoryLink::open(std::string const &name)
+{
+  logging::Logger _log{"com::SharedMemoryLink"};
+  PRECICE_TRACE(name);
+
+  int fd = -1;
+  while ((fd = shm_open(name.c_str(), O_RDWR, S_IRUSR | S_IWUSR)) == -1) {
+    PRECICE_CHECK(errno == ENOENT, "Opening the shared memory segment \"{}\" failed with the system error: {}", name, std::strerror(errno));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // The segment is resized by the creator after it has been created
+  struct stat status;
+  while (true) {
+    PRECICE_CHECK(fstat(fd, &status) == 0, "Accessing the shared memory segment \"{}\" failed with the system error: {}", name, std::strerror(errno));
+    if (static_cast<size_t>(status.st_size) >= sizeof(Segment)) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  const size_t size    = status.st_size;
+  void *       mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  PRECICE_CHECK(mapping != MAP_FAILED, "Mapping the shared memory segment \"{}\" failed with the system error: {}", name, std::strerror(errno));
+
+  auto segment = static_cast<Segment *>(mapping);
+  while (segment->magic.value.load(std::memory_order_acquire) != segmentMagic) {
+    std::this_thread::yield();
+  }
+  PRECICE_ASSERT(size == sizeof(Segment) + 2 * segment->capacity.value.load(), size, segment->capacity.value.load());
+
+  // Both sides are attached, the memory is released as soon as both unmap it
+  shm_unlink(name.c_str());
+
+  return std::shared_ptr<SharedMemoryLink>(new SharedMemoryLink(mapping, size, 0));
+}
+
+SharedMemoryLink::SharedMemoryLink(void *mapping, size_t mappingSize, int side)
+    : _mapping(mapping),
+      _mappingSize(mappingSize),
+      _segment(static_cast<Segment *>(mapping)),
+      _side(side)
+{
+}
+
+SharedMemoryLink::~SharedMemoryLink()
+{
+  munmap(_mapping, _mappingSize);
+}
+
+void SharedMemoryLink::write(void const *data, size_t size)
+{
+  if (_writes.empty()) {
+    // Fast path without allocation, if the ring buffer has enough space
+    Transfer transfer{static_cast<char *>(const_cast<void *>(data)), size};
+    if (progressWrite(transfer)) {
+      notifyPeer();
+    }
+    if (transfer.complete()) {
+      return;
+    }
+    auto pending = std::make_shared<Transfer>(transfer);
+    _writes.push_back(pending);
+    wait(*pending);
+    return;
+  }
+  wait(*asyncWrite(data, size));
+}
+
+void SharedMemoryLink::read(void *data, size_t size)
+{
+  if (_reads.empty()) {
+    Transfer transfer{static_cast<char *>(data), size};
+    if (progressRead(transfer)) {
+      notifyPeer();
+    }
+    if (transfer.complete()) {
+      return;
+    }
+    auto pending = std::make_shared<Transfer>(transfer);
+    _reads.push_back(pending);
+    wait(*pending);
+    return;
+  }
+  wait(*asyncRead(data, size));
+}
+
+SharedMemoryLink::PtrTransfer SharedMemoryLink::asyncWrite(void const *data, size_t size)
+{
+  auto transfer = std::make_shared<Transfer>(Transfer{static_cast<char *>(const_cast<void *>(data)), size});
+  _writes.push_back(transfer);
+  progress();
+  return transfer;
+}
+
+SharedMemoryLink::PtrTransfer SharedMemoryLink::asyncRead(void *data, size_t size)
+{
+  auto transfer = std::make_shared<Transfer>(Transfer{static_cast<char *>(data), size});
+  _reads.push_back(transfer);
+  progress();
+  return transfer;
+}
+
+bool SharedMemoryLink::progress()
+{
+  bool changed = false;
+  while (not _writes.empty()) {
+    changed |= progressWrite(*_writes.front());
+    if (not _writes.front()->complete()) {
+      break;
+    }
+    _writes.pop_front();
+  }
+  while (not _reads.empty()) {
+    changed |= progressRead(*_reads.front());
+    if (not _reads.front()->complete()) {
+      break;
+    }
+    _reads.pop_front();
+  }
+  if (changed) {
+    notifyPeer();
+  }
+  return changed;
+}
+
+void SharedMemoryLink::wait(Transfer const &transfer)
+{
+  waitUntil([&transfer] { return transfer.complete(); });
+}
+
+void SharedMemoryLink::flush()
+{
+  waitUntil([this] { return _writes.empty(); });
+}
+
+bool SharedMemoryLink::progressWrite(Transfer &transfer)
+{
+  auto &         written  = _segment->written[_side].value;
+  const uint64_t capacity = _segment->capacity.value.load(std::memory_order_relaxed);
+  const uint64_t head     = written.load(std::memory_order_relaxed);
+  const uint64_t space    = capacity - (head - _segment->read[_side].value.load(std::memory_order_acquire));
+  const size_t   count    = std::min<uint64_t>(space, transfer.size - transfer.transferred);
+  if (count == 0) {
+    return false;
+  }
+
+  char *       ring  = _segment->ring(_side);
+  const size_t start = head % capacity;
+  const size_t first = std::min<size_t>(count, capacity - start);
+  std::memcpy(ring + start, transfer.data + transfer.transferred, first);
+  std::memcpy(ring, transfer.data + transfer.transferred + first, count - first);
+
+  written.store(head + count, std::memory_order_release);
+  transfer.transferred += count;
+  return true;
+}
+
+bool SharedMemoryLink::progressRead(Transfer &transfer)
+{
+  const int      peer     = 1 - _side;
+  auto &         read     = _segment->read[peer].value;
+  const uint64_t capacity = _segment->capacity.value.load(std::memory_order_relaxed);
+  const uint64_t tail     = read.load(std::memory_order_relaxed);
+  const uint64_t filled   = _segment->written[peer].value.load(std::memory_order_acquire) - tail;
+  const size_t   count    = std::min<uint64_t>(filled, transfer.size - transfer.transferred);
+  if (count == 0) {
+    return false;
+  }
+
+  const char * ring  = _segment->ring(peer);
+  const size_t start = tail % capacity;
+  const size_t first = std::min<size_t>(count, capacity - start);
+  std::memcpy(transfer.data + transfer.transferred, ring + start, first);
+  std::memcpy(transfer.data + transfer.transferred + first, ring, count - first);
+
+  read.store(tail + count, std::memory_order_release);
+  transfer.transferred += count;
+  return true;
+}
+
+template <typename Predicate>
+void SharedMemoryLink::waitUntil(Predicate const &predicate)
+{
+  int attempts = 0;
+  while (true) {
+    // Read the doorbell first, such that changes during the progress are not missed
+    const uint32_t doorbell = _segment->doorbell[_side].value.load();
+    if (progress()) {
+      attempts = 0;
+    }
+    if (predicate()) {
+      return;
+    }
+    if (++attempts < spinAttempts) {
+      std::this_thread::yield();
+    } else {
+      sleep(doorbell);
+    }
+  }
+}
+
+void SharedMemoryLink::sleep(uint32_t doorbell)
+{
+#ifdef __linux__
+  auto &sleeping = _segment->sleeping[_side].value;
+  sleeping.store(1);
+  futexWait(_segment->doorbell[_side].value, doorbell);
+  sleeping.store(0);
+#else
+  std::this_thread::sleep_for(std::chrono::microseconds(50));
+#endif
+}
+
+void SharedMemoryLink::notifyPeer()
+{
+  const int peer = 1 - _side;
+  _segment->doorbell[peer].value.fetch_add(1);
+#ifdef __linux__
+  if (_segment->sleeping[peer].value.load() != 0) {
+    futexWake(_segment->doorbell[peer].value);
+  }
+#endif
+}
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace com {
+
+/**
+ * @brief Bidirectional byte stream between two processes on the same node, based on POSIX shared memory.
+ *
+ * The link consists of a named shared memory segment holding one ring buffer per direction.
+ * It is created by the requesting side and opened by the accepting side, which removes the name afterwards.
+ *
+ * Transfers of a link are processed in order of submission, separately for both directions.
+ * There is no background progress: pending transfers advance whenever the link is used,
+ * hence every blocking operation also advances the transfers of the opposite direction.
+ * A blocked process sleeps on a futex (Linux), which the peer wakes up whenever it changed the state of the link.
+ */
+class SharedMemoryLink {
+public:
+  /// A pending read or write of the link
+  struct Transfer {
+    char * data;
+    size_t size;
+    size_t transferred = 0;
+
+    bool complete() const
+    {
+      return transferred == size;
+    }
+  };
+
+  using PtrTransfer = std::shared_ptr<Transfer>;
+
+  /// Creates a new shared memory segment with ring buffers of the given capacity in bytes
+  static std::shared_ptr<SharedMemoryLink> create(std::string const &name, size_t capacity);
+
+  /// Opens the segment created by the peer, blocks until it is available
+  static std::shared_ptr<SharedMemoryLink> open(std::string const &name);
+
+  SharedMemoryLink(SharedMemoryLink const &) = delete;
+  SharedMemoryLink &operator=(SharedMemoryLink const &) = delete;
+
+  ~SharedMemoryLink();
+
+  /// Writes the bytes to the peer, blocks until they have been written to the ring buffer
+  void write(void const *data, size_t size);
+
+  /// Reads the bytes from the peer, blocks until all of them have been received
+  void read(void *data, size_t size);
+
+  /// Starts a write, the data needs to stay valid until the transfer is complete
+  PtrTransfer asyncWrite(void const *data, size_t size);
+
+  /// Starts a read, the data needs to stay valid until the transfer is complete
+  PtrTransfer asyncRead(void *data, size_t size);
+
+  /// Advances all pending transfers without blocking, returns true if any bytes were transferred
+  bool progress();
+
+  /// Blocks until the transfer is complete
+  void wait(Transfer const &transfer);
+
+  /// Blocks until all pending writes are complete
+  void flush();
+
+private:
+  struct Segment;
+
+  SharedMemoryLink(void *mapping, size_t mappingSize, int side);
+
+  /// Copies as many bytes of the front pending write as possible, returns true if any bytes were copied
+  bool progressWrite(Transfer &transfer);
+
+  /// Copies as many bytes of the front pending read as possible, returns true if any bytes were copied
+  bool progressRead(Transfer &transfer);
+
+  /// Advances the transfers until the predicate is fulfilled, sleeps if no progress can be made
+  template <typename Predicate>
+  void waitUntil(Predicate const &predicate);
+
+  /// Sleeps until the peer rings the doorbell, if it has not been rung since it showed the given value
+  void sleep(uint32_t doorbell);
+
+  /// Signals the peer that the link has changed
+  void notifyPeer();
+
+  logging::Logger _log{"com::SharedMemoryLink"};
+
+  void *   _mapping;
+  size_t   _mappingSize;
+  Segment *_segment;
+
+  /// 0 for the accepting, 1 for the requesting side
+  int _side;
+
+  std::deque<PtrTransfer> _writes;
+  std::deque<PtrTransfer> _reads;
+};
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,25 @@
+#include "SharedMemoryRequest.hpp"
+#include <utility>
+
+namespace precice {
+namespace com {
+SharedMemoryRequest::SharedMemoryRequest(std::shared_ptr<SharedMemoryLink> link, SharedMemoryLink::PtrTransfer transfer)
+    : _link(std::move(link)),
+      _transfer(std::move(transfer))
+{
+}
+
+bool SharedMemoryRequest::test()
+{
+  if (not _transfer->complete()) {
+    _link->progress();
+  }
+  return _transfer->complete();
+}
+
+void SharedMemoryRequest::wait()
+{
+  _link->wait(*_transfer);
+}
+} // namespace com
+} // namespace precice
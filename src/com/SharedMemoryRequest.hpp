@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include "Request.hpp"
+#include "com/SharedMemoryLink.hpp"
+
+namespace precice {
+namespace com {
+/// Request of a SharedMemoryCommunication, which advances the link it belongs to while waiting.
+class SharedMemoryRequest : public Request {
+public:
+  SharedMemoryRequest(std::shared_ptr<SharedMemoryLink> link, SharedMemoryLink::PtrTransfer transfer);
+
+  bool test() override;
+
+  void wait() override;
+
+private:
+  std::shared_ptr<SharedMemoryLink> _link;
+
+  SharedMemoryLink::PtrTransfer _transfer;
+};
+} // namespace com
+} // namespace precice
@@ -22,11 +22,13 @@ namespace asio = boost::asio;
 SocketCommunication::SocketCommunication(unsigned short portNumber,
                                          bool           reuseAddress,
                                          std::string    networkName,
-                                         std::string    addressDirectory)
+                                         std::string    addressDirectory,
+                                         bool           noDelay)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(std::move(networkName)),
       _addressDirectory(std::move(addressDirectory)),
+      _noDelay(noDelay),
       _ioService(new IOService)
 {
   if (_addressDirectory.empty()) {
@@ -94,6 +96,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
       auto socket = std::make_shared<Socket>(*_ioService);
 
       acceptor.accept(*socket);
+      configureSocket(*socket);
       PRECICE_DEBUG("Accepted connection at {}", address);
       _isConnected = true;
 
@@ -179,6 +182,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
     for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
       auto socket = std::make_shared<Socket>(*_ioService);
       acceptor.accept(*socket);
+      configureSocket(*socket);
       PRECICE_DEBUG("Accepted connection at {}", address);
       _isConnected = true;
 
@@ -238,6 +242,7 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
     }
 
     PRECICE_DEBUG("Requested connection to {}", address);
+    configureSocket(*socket);
 
     asio::write(*socket, asio::buffer(&requesterRank, sizeof(int)));
 
@@ -301,6 +306,7 @@ void SocketCommunication::requestConnectionAsClient(std::string const &  accepto
       }
 
       PRECICE_DEBUG("Requested connection to {}, rank = {}", address, acceptorRank);
+      configureSocket(*socket);
       _sockets[acceptorRank] = socket;
       send(requesterRank, acceptorRank); // send my rank
 
@@ -320,6 +326,8 @@ void SocketCommunication::closeConnection()
   if (not isConnected())
     return;
 
+  closeCollectiveTree();
+
   if (_thread.joinable()) {
     _work.reset();
     _ioService->stop();
@@ -374,6 +382,12 @@ void SocketCommunication::send(precice::span<const int> itemsToSend, Rank rankRe
   }
 }
 
+PtrCommunication SocketCommunication::newTreeCommunication() const
+{
+  // The links of the tree listen on any free port, the configured one is used by the master
+  return std::make_shared<SocketCommunication>(0, false, _networkName, _addressDirectory, _noDelay);
+}
+
 void SocketCommunication::prepareEstablishment(std::string const &acceptorName,
                                                std::string const &requesterName)
 {
@@ -897,6 +911,13 @@ std::vector<Interface> detectInterfaces()
 } // namespace
 #endif
 
+void SocketCommunication::configureSocket(Socket &socket)
+{
+  if (_noDelay) {
+    socket.set_option(asio::ip::tcp::no_delay(true));
+  }
+}
+
 std::string SocketCommunication::getIpAddress()
 {
   PRECICE_TRACE();
@@ -24,7 +24,8 @@ public:
   SocketCommunication(unsigned short portNumber       = 0,
                       bool           reuseAddress     = false,
                       std::string    networkName      = utils::networking::loopbackInterfaceName(),
-                      std::string    addressDirectory = ".");
+                      std::string    addressDirectory = ".",
+                      bool           noDelay          = false);
 
   explicit SocketCommunication(std::string const &addressDirectory);
 
@@ -140,6 +141,9 @@ public:
   virtual void cleanupEstablishment(std::string const &acceptorName,
                                     std::string const &requesterName) override;
 
+protected:
+  virtual PtrCommunication newTreeCommunication() const override;
+
 private:
   logging::Logger _log{"com::SocketCommunication"};
 
@@ -154,6 +158,9 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
+  /// Whether to disable Nagle's algorithm (TCP_NODELAY) on all sockets.
+  bool _noDelay;
+
   using IOService = boost::asio::io_service;
   using Socket    = boost::asio::ip::tcp::socket;
   using Work      = boost::asio::io_service::work;
@@ -170,6 +177,9 @@ private:
   bool isClient();
   bool isServer();
 
+  /// Applies the socket options to a connected socket.
+  void configureSocket(Socket &socket);
+
   std::string getIpAddress();
 };
 } // namespace com
@@ -12,11 +12,13 @@ SocketCommunicationFactory::SocketCommunicationFactory(
     unsigned short portNumber,
     bool           reuseAddress,
     std::string    networkName,
-    std::string    addressDirectory)
+    std::string    addressDirectory,
+    bool           noDelay)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(std::move(networkName)),
-      _addressDirectory(std::move(addressDirectory))
+      _addressDirectory(std::move(addressDirectory)),
+      _noDelay(noDelay)
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -32,7 +34,7 @@ SocketCommunicationFactory::SocketCommunicationFactory(
 PtrCommunication SocketCommunicationFactory::newCommunication()
 {
   return std::make_shared<SocketCommunication>(
-      _portNumber, _reuseAddress, _networkName, _addressDirectory);
+      _portNumber, _reuseAddress, _networkName, _addressDirectory, _noDelay);
 }
 
 std::string SocketCommunicationFactory::addressDirectory()
@@ -13,7 +13,8 @@ public:
   SocketCommunicationFactory(unsigned short portNumber       = 0,
                              bool           reuseAddress     = false,
                              std::string    networkName      = utils::networking::loopbackInterfaceName(),
-                             std::string    addressDirectory = ".");
+                             std::string    addressDirectory = ".",
+                             bool           noDelay          = false);
 
   explicit SocketCommunicationFactory(std::string const &addressDirectory);
 
@@ -26,6 +27,7 @@ private:
   bool           _reuseAddress;
   std::string    _networkName;
   std::string    _addressDirectory;
+  bool           _noDelay;
 };
 } // namespace com
 } // namespace precice
@@ -23,7 +23,10 @@ void SocketSendQueue::dispatch(std::shared_ptr<Socket>      sock,
                                boost::asio::const_buffers_1 data,
                                std::function<void()>        callback)
 {
-  _itemQueue.push_back({std::move(sock), std::move(data), std::move(callback)});
+  {
+    std::lock_guard<std::mutex> lock(_sendMutex);
+    _itemQueue.push_back({std::move(sock), std::move(data), std::move(callback)});
+  }
   process(); // if queue was previously empty, start it now.
 }
 
@@ -32,14 +35,32 @@ void SocketSendQueue::process()
   std::lock_guard<std::mutex> lock(_sendMutex);
   if (!_ready || _itemQueue.empty())
     return;
-  auto item = _itemQueue.front();
-  _itemQueue.pop_front();
+
+  // Drain all consecutive items for the same socket
+  auto batch = std::make_shared<std::vector<SendItem>>();
+  auto sock  = _itemQueue.front().sock;
+  while (!_itemQueue.empty() && _itemQueue.front().sock == sock && batch->size() < maxBatchSize) {
+    batch->push_back(std::move(_itemQueue.front()));
+    _itemQueue.pop_front();
+  }
+
+  std::vector<asio::const_buffer> buffers;
+  buffers.reserve(batch->size());
+  for (const auto &item : *batch) {
+    buffers.push_back(*item.data.begin());
+  }
+
   _ready = false;
-  asio::async_write(*(item.sock),
-                    item.data,
-                    [item, this](boost::system::error_code const &, std::size_t) {
-                      item.callback();
-                      this->_ready = true;
+  asio::async_write(*sock,
+                    buffers,
+                    [batch, this](boost::system::error_code const &, std::size_t) {
+                      for (const auto &item : *batch) {
+                        item.callback();
+                      }
+                      {
+                        std::lock_guard<std::mutex> lock(this->_sendMutex);
+                        this->_ready = true;
+                      }
                       this->process();
                     });
 }
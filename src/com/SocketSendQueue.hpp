@@ -6,6 +6,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 #include "logging/Logger.hpp"
 
 namespace precice {
@@ -13,6 +14,7 @@ namespace com {
 
 /// This Queue is intended for SocketCommunication to push requests which should be sent onto it.
 /// It ensures that the invocations of asio::aSend are done serially.
+/// Consecutive items for the same socket are written together using a single vectored write.
 class SocketSendQueue {
 public:
   using Socket = boost::asio::ip::tcp::socket;
@@ -30,6 +32,9 @@ private:
   /// This method can be called arbitrarily many times, but enough times to ensure the queue makes progress.
   void process();
 
+  /// Maximal number of items written by a single vectored write
+  static constexpr std::size_t maxBatchSize = 64;
+
   struct SendItem {
     std::shared_ptr<Socket>      sock;
     boost::asio::const_buffers_1 data;
@@ -3,6 +3,7 @@
 #include <ostream>
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunication.hpp"
+#include "com/SharedMemoryCommunication.hpp"
 #include "com/SocketCommunication.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/Helpers.hpp"
@@ -24,8 +25,9 @@ PtrCommunication CommunicationConfiguration::createCommunication(
                   "Please check the \"ports=\" attributes of your socket connections.",
                   port);
 
-    std::string dir = tag.getStringAttributeValue("exchange-directory");
-    com             = std::make_shared<com::SocketCommunication>(port, false, network, dir);
+    std::string dir     = tag.getStringAttributeValue("exchange-directory");
+    bool        noDelay = tag.getBooleanAttributeValue("no-delay");
+    com                 = std::make_shared<com::SocketCommunication>(port, false, network, dir, noDelay);
   } else if (tag.getName() == "mpi") {
     std::string dir = tag.getStringAttributeValue("exchange-directory");
 #ifdef PRECICE_NO_MPI
@@ -41,6 +43,9 @@ PtrCommunication CommunicationConfiguration::createCommunication(
 #else
     com = std::make_shared<com::MPIDirectCommunication>();
 #endif
+  } else if (tag.getName() == "shm") {
+    std::string dir = tag.getStringAttributeValue("exchange-directory");
+    com             = std::make_shared<com::SharedMemoryCommunication>(dir);
   }
   PRECICE_ASSERT(com != nullptr);
   return com;
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <memory>
 #include "com/CommunicateMesh.hpp"
+#include "com/Request.hpp"
 #include "com/SharedPointer.hpp"
 #include "m2n/M2N.hpp"
 #include "mesh/Mesh.hpp"
@@ -135,6 +136,62 @@ BOOST_AUTO_TEST_CASE(BroadcastVertexEdgeTriangleMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(AsyncSendToMeshWithEdges)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  auto m2n = context.connectMasters("A", "B");
+
+  const int dim      = 3;
+  const int vertices = 1000;
+
+  CommunicateMesh comMesh(m2n->getMasterCommunication());
+
+  if (context.isNamed("A")) {
+    com::PtrRequest request;
+    {
+      // A strip of triangles
+      mesh::Mesh sendMesh("Sent Mesh", dim, testing::nextMeshID());
+      for (int i = 0; i < vertices; ++i) {
+        mesh::Vertex &v = sendMesh.createVertex(Eigen::Vector3d(i / 2, i % 2, 0));
+        v.setGlobalIndex(10 * i);
+      }
+      for (int i = 0; i + 2 < vertices; ++i) {
+        auto &      v  = sendMesh.vertices();
+        mesh::Edge &e0 = sendMesh.createUniqueEdge(v[i], v[i + 1]);
+        mesh::Edge &e1 = sendMesh.createUniqueEdge(v[i + 1], v[i + 2]);
+        mesh::Edge &e2 = sendMesh.createUniqueEdge(v[i + 2], v[i]);
+        sendMesh.createTriangle(e0, e1, e2);
+      }
+      request = comMesh.aSendMesh(sendMesh, 0);
+    }
+    // The request holds the serialized mesh
+    request->wait();
+  } else {
+    // The received mesh is appended to the existing elements
+    mesh::Mesh    recvMesh("Received Mesh", dim, testing::nextMeshID());
+    mesh::Vertex &v0 = recvMesh.createVertex(Eigen::Vector3d::Constant(-1));
+    mesh::Vertex &v1 = recvMesh.createVertex(Eigen::Vector3d::Constant(-2));
+    recvMesh.createEdge(v0, v1);
+    comMesh.receiveMesh(recvMesh, 0);
+
+    BOOST_TEST(recvMesh.vertices().size() == vertices + 2);
+    BOOST_TEST(recvMesh.edges().size() == 2 * vertices - 2);
+    BOOST_TEST(recvMesh.triangles().size() == vertices - 2);
+    for (int i = 0; i < vertices; ++i) {
+      const mesh::Vertex &v = recvMesh.vertices()[i + 2];
+      BOOST_TEST(v.getGlobalIndex() == 10 * i);
+      BOOST_TEST(testing::equals(v.getCoords(), Eigen::Vector3d(i / 2, i % 2, 0)));
+    }
+    const mesh::Edge &edge = recvMesh.edges()[1];
+    BOOST_TEST(edge.vertex(0).getID() == 2);
+    BOOST_TEST(edge.vertex(1).getID() == 3);
+    const mesh::Triangle &last = recvMesh.triangles().back();
+    std::vector<int>      ids{last.vertex(0).getID(), last.vertex(1).getID(), last.vertex(2).getID()};
+    std::sort(ids.begin(), ids.end());
+    BOOST_TEST(ids == (std::vector<int>{vertices - 1, vertices, vertices + 1}), boost::test_tools::per_element());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Communication
 
@@ -771,6 +771,134 @@ void TestSendAndReceive(TestContext const &context)
   TestReduceVectors<T>(context);
 }
 
+/// Tests the collective operations passing their data along the collective tree
+template <typename T>
+void TestCollectiveTree(TestContext const &context)
+{
+  T com;
+  com.connectMasterSlaves("Tree", "", context.rank, context.size);
+  BOOST_TEST(com.hasCollectiveTree());
+
+  // The sum of 1 + 2 + ... + size
+  const int    sum   = context.size * (context.size + 1) / 2;
+  const double value = context.rank + 1;
+
+  if (context.isMaster()) {
+    {
+      int rcv = 0;
+      com.reduceSum(1, rcv);
+      BOOST_TEST(rcv == context.size);
+    }
+    {
+      std::vector<double> msg{value, 2 * value};
+      std::vector<double> rcv{0, 0};
+      com.reduceSum(msg, rcv);
+      BOOST_TEST(rcv == std::vector<double>({1.0 * sum, 2.0 * sum}), boost::test_tools::per_element());
+    }
+    {
+      int rcv = 0;
+      com.allreduceSum(context.rank + 1, rcv);
+      BOOST_TEST(rcv == sum);
+    }
+    {
+      double rcv = 0;
+      com.allreduceSum(value, rcv);
+      BOOST_TEST(rcv == sum);
+    }
+    {
+      std::vector<double> msg{value, -value};
+      std::vector<double> rcv{0, 0};
+      com.allreduceSum(msg, rcv);
+      BOOST_TEST(rcv == std::vector<double>({1.0 * sum, -1.0 * sum}), boost::test_tools::per_element());
+    }
+    com.broadcast(42);
+    com.broadcast(3.1415);
+    com.broadcast(std::vector<int>{2, 3, 5, 8});
+    com.broadcast(std::vector<double>{1.2, 2.3});
+  } else {
+    {
+      int rcv = 0;
+      com.reduceSum(1, rcv, 0);
+    }
+    {
+      std::vector<double> msg{value, 2 * value};
+      std::vector<double> rcv{0, 0};
+      com.reduceSum(msg, rcv, 0);
+      BOOST_TEST(msg == std::vector<double>({value, 2 * value}), boost::test_tools::per_element());
+    }
+    {
+      int rcv = 0;
+      com.allreduceSum(context.rank + 1, rcv, 0);
+      BOOST_TEST(rcv == sum);
+    }
+    {
+      double rcv = 0;
+      com.allreduceSum(value, rcv, 0);
+      BOOST_TEST(rcv == sum);
+    }
+    {
+      std::vector<double> msg{value, -value};
+      std::vector<double> rcv{0, 0};
+      com.allreduceSum(msg, rcv, 0);
+      BOOST_TEST(rcv == std::vector<double>({1.0 * sum, -1.0 * sum}), boost::test_tools::per_element());
+    }
+    {
+      int msg = 0;
+      com.broadcast(msg, 0);
+      BOOST_TEST(msg == 42);
+    }
+    {
+      double msg = 0;
+      com.broadcast(msg, 0);
+      BOOST_TEST(msg == 3.1415);
+    }
+    {
+      std::vector<int> msg;
+      com.broadcast(msg, 0);
+      BOOST_TEST(msg == std::vector<int>({2, 3, 5, 8}), boost::test_tools::per_element());
+    }
+    {
+      std::vector<double> msg;
+      com.broadcast(msg, 0);
+      BOOST_TEST(msg == std::vector<double>({1.2, 2.3}), boost::test_tools::per_element());
+    }
+  }
+  com.closeConnection();
+  BOOST_TEST(not com.hasCollectiveTree());
+}
+
+/// Restarts a persistent send and receive several times, the buffers are refilled in between
+template <typename T>
+void TestPersistentRequests(TestContext const &context)
+{
+  T                   com;
+  std::vector<double> buffer(3, 0.0);
+
+  if (context.isMaster()) {
+    com.acceptConnection("Master", "Slave", "", 0, 1);
+    auto request = com.sendInit(buffer, 1);
+    BOOST_REQUIRE(request);
+    for (int i = 0; i < 5; ++i) {
+      buffer = {1.0 * i, 2.0 * i, 3.0 * i};
+      request->start();
+      request->wait();
+    }
+    request.reset();
+    com.closeConnection();
+  } else {
+    com.requestConnection("Master", "Slave", "", 0, 1);
+    auto request = com.receiveInit(buffer, 0);
+    BOOST_REQUIRE(request);
+    for (int i = 0; i < 5; ++i) {
+      request->start();
+      request->wait();
+      BOOST_TEST(buffer == std::vector<double>({1.0 * i, 2.0 * i, 3.0 * i}), boost::test_tools::per_element());
+    }
+    request.reset();
+    com.closeConnection();
+  }
+}
+
 } // namespace masterslave
 
 namespace serverclient {
@@ -20,6 +20,12 @@ BOOST_AUTO_TEST_CASE(SendAndReceive)
   testing::com::masterslave::TestSendAndReceive<MPIDirectCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(PersistentRequests)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  testing::com::masterslave::TestPersistentRequests<MPIDirectCommunication>(context);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // MPIDirectCommunication
 
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -29,6 +29,20 @@ BOOST_AUTO_TEST_CASE(SendAndReceiveMS)
   TestSendAndReceive<MPIPortsCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(CollectiveTree)
+{
+  PRECICE_TEST(4_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestCollectiveTree<MPIPortsCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(PersistentRequestsMS)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestPersistentRequests<MPIPortsCommunication>(context);
+}
+
 BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesMM)
 {
   PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
@@ -0,0 +1,124 @@
+#include <numeric>
+#include <vector>
+#include "GenericTestFunctions.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(SendAndReceiveMM)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::mastermaster;
+  TestSendAndReceive<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendAndReceiveMS)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestSendAndReceive<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(CollectiveTree)
+{
+  PRECICE_TEST(4_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestCollectiveTree<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::mastermaster;
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwoProcessesServerClient)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClient)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>(context);
+}
+
+/// Exchanges messages, which are much larger than the ring buffers, in both directions at the same time
+BOOST_AUTO_TEST_CASE(LargeMessages)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  SharedMemoryCommunication com(".", 256);
+
+  const int           peer = 0;
+  std::vector<double> send(10000);
+  std::iota(send.begin(), send.end(), context.isNamed("A") ? 0.0 : 1.0);
+  std::vector<double> received(send.size(), -1.0);
+
+  if (context.isNamed("A")) {
+    com.acceptConnection("A", "B", "", 0);
+  } else {
+    com.requestConnection("A", "B", "", 0, 1);
+  }
+
+  // Both sides send first, which only completes if the receive advances the pending send
+  auto request = com.aSend(send, peer);
+  com.receive(precice::span<double>{received}, peer);
+  request->wait();
+
+  std::vector<double> expected(send.size());
+  std::iota(expected.begin(), expected.end(), context.isNamed("A") ? 1.0 : 0.0);
+  BOOST_TEST(received == expected, boost::test_tools::per_element());
+
+  com.closeConnection();
+}
+
+/// Exchanges messages, which are much larger than the ring buffers, by blocking sends and receives
+BOOST_AUTO_TEST_CASE(LargeBlockingMessages)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  SharedMemoryCommunication com(".", 256);
+
+  const int           peer = 0;
+  std::vector<double> send(10000);
+  std::iota(send.begin(), send.end(), context.isNamed("A") ? 0.0 : 1.0);
+  std::vector<double> received(send.size(), -1.0);
+
+  // The blocking send waits for the peer to drain the ring buffer several times
+  if (context.isNamed("A")) {
+    com.acceptConnection("A", "B", "", 0);
+    com.send(precice::span<const double>{send}, peer);
+    com.receive(precice::span<double>{received}, peer);
+  } else {
+    com.requestConnection("A", "B", "", 0, 1);
+    com.receive(precice::span<double>{received}, peer);
+    com.send(precice::span<const double>{send}, peer);
+  }
+
+  std::vector<double> expected(send.size());
+  std::iota(expected.begin(), expected.end(), context.isNamed("A") ? 1.0 : 0.0);
+  BOOST_TEST(received == expected, boost::test_tools::per_element());
+
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // Communication
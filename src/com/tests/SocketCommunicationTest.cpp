@@ -1,3 +1,4 @@
+#include <chrono>
 #include <vector>
 #include "GenericTestFunctions.hpp"
 #include "com/SharedPointer.hpp"
@@ -29,6 +30,13 @@ BOOST_AUTO_TEST_CASE(SendAndReceiveMS)
   TestSendAndReceive<SocketCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(CollectiveTree)
+{
+  PRECICE_TEST(4_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestCollectiveTree<SocketCommunication>(context);
+}
+
 BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses)
 {
   PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
@@ -57,5 +65,50 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2)
   TestSendReceiveFourProcessesServerClientV2<SocketCommunication>(context);
 }
 
+/// Sends many small messages asynchronously and reports the time per message with and without TCP_NODELAY
+BOOST_AUTO_TEST_CASE(SmallMessagesBenchmark)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  constexpr int messages = 10000;
+  constexpr int rounds   = 10;
+
+  for (bool noDelay : {false, true}) {
+    SocketCommunication com(0, false, utils::networking::loopbackInterfaceName(), ".", noDelay);
+    std::vector<double> values(messages);
+
+    const auto start = std::chrono::steady_clock::now();
+    if (context.isNamed("A")) {
+      com.acceptConnection("A", "B", "", 0);
+      for (int round = 0; round < rounds; ++round) {
+        std::vector<PtrRequest> requests;
+        requests.reserve(messages);
+        for (int i = 0; i < messages; ++i) {
+          values[i] = round * messages + i;
+          requests.push_back(com.aSend(precice::span<const double>{&values[i], 1}, 0));
+        }
+        Request::wait(requests);
+        int ack = 0;
+        com.receive(ack, 0);
+        BOOST_TEST(ack == round);
+      }
+    } else {
+      com.requestConnection("A", "B", "", 0, 1);
+      for (int round = 0; round < rounds; ++round) {
+        bool inOrder = true;
+        for (int i = 0; i < messages; ++i) {
+          double value = -1.0;
+          com.receive(value, 0);
+          inOrder &= (value == round * messages + i);
+        }
+        BOOST_TEST(inOrder);
+        com.send(round, 0);
+      }
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    BOOST_TEST_MESSAGE((noDelay ? "no-delay" : "default ") << " time per message [us]: " << elapsed.count() / (rounds * messages));
+    com.closeConnection();
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
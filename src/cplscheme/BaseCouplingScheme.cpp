@@ -1,9 +1,12 @@
 #include <Eigen/Core>
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <map>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "BaseCouplingScheme.hpp"
 #include "acceleration/Acceleration.hpp"
@@ -12,6 +15,8 @@
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "impl/ConvergenceMeasure.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "io/TXTTableWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "math/differences.hpp"
@@ -24,6 +29,18 @@
 namespace precice {
 namespace cplscheme {
 
+namespace {
+/// Groups the coupling data by their mesh, keeping the order of the data IDs within each mesh
+std::map<int, std::vector<PtrCouplingData>> groupDataByMesh(const std::map<int, PtrCouplingData> &dataMap)
+{
+  std::map<int, std::vector<PtrCouplingData>> dataPerMesh;
+  for (const auto &pair : dataMap) {
+    dataPerMesh[pair.second->getMeshID()].push_back(pair.second);
+  }
+  return dataPerMesh;
+}
+} // namespace
+
 BaseCouplingScheme::BaseCouplingScheme(
     double                        maxTime,
     int                           maxTimeWindows,
@@ -85,9 +102,33 @@ void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendDat
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
 
+  if (std::find(_sendingM2Ns.begin(), _sendingM2Ns.end(), m2n) == _sendingM2Ns.end()) {
+    _sendingM2Ns.push_back(m2n);
+  }
+
+  if (m2n->usesPackedExchange()) {
+    // All data of a mesh is sent at once, both participants group the data in the same order
+    // The packed message uses the compression of the m2n, individual compressions of the data do not apply
+    for (const auto &meshData : groupDataByMesh(sendData)) {
+      std::vector<precice::span<double const>> values;
+      std::vector<int>                         dimensions;
+      for (const PtrCouplingData &data : meshData.second) {
+        values.emplace_back(data->values());
+        dimensions.push_back(data->getDimensions());
+      }
+      m2n->send(values, meshData.first, dimensions);
+    }
+    PRECICE_DEBUG("Number of sent data sets = {}", sendData.size());
+    return;
+  }
+
   for (const DataMap::value_type &pair : sendData) {
     // Data is actually only send if size>0, which is checked in the derived classes implementaiton
-    m2n->send(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
+    if (const m2n::Compression *compression = pair.second->getCompression()) {
+      m2n->send(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions(), *compression);
+    } else {
+      m2n->send(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
+    }
 
     sentDataIDs.push_back(pair.first);
   }
@@ -100,9 +141,32 @@ void BaseCouplingScheme::receiveData(const m2n::PtrM2N &m2n, const DataMap &rece
   std::vector<int> receivedDataIDs;
   PRECICE_ASSERT(m2n.get());
   PRECICE_ASSERT(m2n->isConnected());
+
+  if (std::find(_sendingM2Ns.begin(), _sendingM2Ns.end(), m2n) == _sendingM2Ns.end()) {
+    _sendingM2Ns.push_back(m2n);
+  }
+
+  if (m2n->usesPackedExchange()) {
+    for (const auto &meshData : groupDataByMesh(receiveData)) {
+      std::vector<precice::span<double>> values;
+      std::vector<int>                   dimensions;
+      for (const PtrCouplingData &data : meshData.second) {
+        values.emplace_back(data->values());
+        dimensions.push_back(data->getDimensions());
+      }
+      m2n->receive(values, meshData.first, dimensions);
+    }
+    PRECICE_DEBUG("Number of received data sets = {}", receiveData.size());
+    return;
+  }
+
   for (const DataMap::value_type &pair : receiveData) {
     // Data is only received on ranks with size>0, which is checked in the derived class implementation
-    m2n->receive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
+    if (const m2n::Compression *compression = pair.second->getCompression()) {
+      m2n->receive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions(), *compression);
+    } else {
+      m2n->receive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
+    }
 
     receivedDataIDs.push_back(pair.first);
   }
@@ -119,6 +183,8 @@ void BaseCouplingScheme::finalize()
   PRECICE_TRACE();
   checkCompletenessRequiredActions();
   PRECICE_ASSERT(_isInitialized, "Called finalize() before initialize().");
+  waitForReceivedData();
+  waitForSentData();
 }
 
 void BaseCouplingScheme::initialize(double startTime, int startTimeWindow)
@@ -189,6 +255,7 @@ void BaseCouplingScheme::initializeData()
   }
 
   exchangeInitialData();
+  waitForSentData();
 
   // @todo duplicate code also in BaseCouplingScheme::initialize().
   if (isImplicitCouplingScheme()) {
@@ -214,6 +281,7 @@ void BaseCouplingScheme::advance()
     _timeWindows += 1; // increment window counter. If not converged, will be decremented again later.
 
     bool convergence = exchangeDataAndAccelerate();
+    waitForSentData();
 
     if (isImplicitCouplingScheme()) { // check convergence
       if (not convergence) {          // repeat window
@@ -315,6 +383,19 @@ bool BaseCouplingScheme::hasDataBeenReceived() const
   return _hasDataBeenReceived;
 }
 
+bool BaseCouplingScheme::sendDataAhead(DataID dataID)
+{
+  return false;
+}
+
+void BaseCouplingScheme::waitForReceivedData(DataID dataID)
+{
+}
+
+void BaseCouplingScheme::waitForReceivedData()
+{
+}
+
 void BaseCouplingScheme::checkDataHasBeenReceived()
 {
   PRECICE_ASSERT(not _hasDataBeenReceived, "checkDataHasBeenReceived() may only be called once within one coupling iteration. If this assertion is triggered this probably means that your coupling scheme has a bug.");
@@ -445,6 +526,57 @@ void BaseCouplingScheme::checkCompletenessRequiredActions()
   }
 }
 
+void BaseCouplingScheme::exportState(const std::string &filenamePrefix) const
+{
+  PRECICE_TRACE(filenamePrefix);
+  PRECICE_ASSERT(_isInitialized && _isTimeWindowComplete, "The state can only be exported at the end of a completed time window.");
+  io::BinaryWriter writer(filenamePrefix + ".state");
+  writer.write(_time);
+  writer.write(_timeWindows);
+  writer.write(_totalIterations);
+  writer.write(static_cast<int>(_allData.size()));
+  for (const DataMap::value_type &pair : _allData) {
+    writer.write(pair.first);
+    pair.second->exportState(writer);
+  }
+  writer.write(_acceleration != nullptr);
+  if (_acceleration) {
+    _acceleration->exportState(writer);
+  }
+  writer.flush();
+}
+
+void BaseCouplingScheme::importState(const std::string &filenamePrefix)
+{
+  PRECICE_TRACE(filenamePrefix);
+  PRECICE_ASSERT(_isInitialized, "The state can only be imported after initialize().");
+  io::BinaryReader reader(filenamePrefix + ".state");
+  reader.read(_time);
+  reader.read(_timeWindows);
+  reader.read(_totalIterations);
+  int dataCount = 0;
+  reader.read(dataCount);
+  PRECICE_CHECK(dataCount == static_cast<int>(_allData.size()),
+                "The checkpoint \"{}\" holds {} coupling data, but the coupling scheme exchanges {}.",
+                filenamePrefix, dataCount, _allData.size());
+  for (DataMap::value_type &pair : _allData) {
+    int dataID = -1;
+    reader.read(dataID);
+    PRECICE_CHECK(dataID == pair.first,
+                  "The checkpoint \"{}\" holds data with ID {}, but the coupling scheme expects data with ID {}.",
+                  filenamePrefix, dataID, pair.first);
+    pair.second->importState(reader);
+  }
+  bool hasAcceleration = false;
+  reader.read(hasAcceleration);
+  PRECICE_CHECK(hasAcceleration == (_acceleration != nullptr),
+                "The checkpoint \"{}\" was written {} acceleration, but the coupling scheme is configured {} acceleration.",
+                filenamePrefix, hasAcceleration ? "with" : "without", _acceleration ? "with" : "without");
+  if (_acceleration) {
+    _acceleration->importState(reader);
+  }
+}
+
 void BaseCouplingScheme::initializeStorages()
 {
   PRECICE_TRACE();
@@ -591,6 +723,15 @@ void BaseCouplingScheme::advanceTXTWriters()
   }
 }
 
+void BaseCouplingScheme::waitForSentData()
+{
+  PRECICE_TRACE();
+  for (const m2n::PtrM2N &m2n : _sendingM2Ns) {
+    m2n->waitForSendRequests();
+  }
+  _sendingM2Ns.clear();
+}
+
 bool BaseCouplingScheme::reachedEndOfTimeWindow()
 {
   return math::equals(getThisTimeWindowRemainder(), 0.0, _eps);
@@ -124,6 +124,15 @@ public:
    */
   bool hasDataBeenReceived() const override final;
 
+  /// Data is sent in advance() only, unless a subclass supports a pipelined exchange.
+  bool sendDataAhead(DataID dataID) override;
+
+  /// Data is received completely in advance(), unless a subclass supports a pipelined exchange.
+  void waitForReceivedData(DataID dataID) override;
+
+  /// Data is received completely in advance(), unless a subclass supports a pipelined exchange.
+  void waitForReceivedData() override;
+
   /**
    * @brief getter for _time
    * @returns the currently computed time of the coupling scheme.
@@ -188,6 +197,12 @@ public:
    */
   std::string printCouplingState() const override;
 
+  /// Writes time, coupling data and acceleration state of this rank to filenamePrefix.state.
+  void exportState(const std::string &filenamePrefix) const override final;
+
+  /// Restores the state written by exportState().
+  void importState(const std::string &filenamePrefix) override final;
+
   /// Finalizes the coupling scheme.
   void finalize() override final;
 
@@ -449,6 +464,9 @@ private:
   /// True, if initialize data has been called.
   bool _initializeDataHasBeenCalled = false;
 
+  /// M2Ns with pending sends of data, which have to be completed before the data is modified
+  std::vector<m2n::PtrM2N> _sendingM2Ns;
+
   std::set<std::string> _actions;
 
   /// Responsible for monitoring iteration count over time window.
@@ -526,6 +544,9 @@ private:
    */
   void checkCompletenessRequiredActions();
 
+  /// Waits until the data sent since the last call is completely sent, such that it may be modified
+  void waitForSentData();
+
   /**
    * @brief Function to check whether end of time window is reached. Does not check for convergence
    * @returns true if end time of time window is reached.
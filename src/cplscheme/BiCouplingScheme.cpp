@@ -50,9 +50,10 @@ BiCouplingScheme::BiCouplingScheme(
 }
 
 void BiCouplingScheme::addDataToSend(
-    const mesh::PtrData &data,
-    mesh::PtrMesh        mesh,
-    bool                 requiresInitialization)
+    const mesh::PtrData &   data,
+    mesh::PtrMesh           mesh,
+    bool                    requiresInitialization,
+    const m2n::Compression *compression)
 {
   PRECICE_TRACE();
   int id = data->getID();
@@ -63,6 +64,9 @@ void BiCouplingScheme::addDataToSend(
     } else {
       pair.second = PtrCouplingData(new CouplingData(data, std::move(mesh), requiresInitialization, getExtrapolationOrder()));
     }
+    if (compression) {
+      pair.second->setCompression(*compression);
+    }
     PRECICE_ASSERT(_sendData.count(pair.first) == 0, "Key already exists!");
     _sendData.insert(pair);
     PRECICE_ASSERT(_allData.count(pair.first) == 0, "Key already exists!");
@@ -73,9 +77,10 @@ void BiCouplingScheme::addDataToSend(
 }
 
 void BiCouplingScheme::addDataToReceive(
-    const mesh::PtrData &data,
-    mesh::PtrMesh        mesh,
-    bool                 requiresInitialization)
+    const mesh::PtrData &   data,
+    mesh::PtrMesh           mesh,
+    bool                    requiresInitialization,
+    const m2n::Compression *compression)
 {
   PRECICE_TRACE();
   int id = data->getID();
@@ -86,6 +91,9 @@ void BiCouplingScheme::addDataToReceive(
     } else {
       pair.second = PtrCouplingData(new CouplingData(data, std::move(mesh), requiresInitialization, getExtrapolationOrder()));
     }
+    if (compression) {
+      pair.second->setCompression(*compression);
+    }
     PRECICE_ASSERT(_receiveData.count(pair.first) == 0, "Key already exists!");
     _receiveData.insert(pair);
     PRECICE_ASSERT(_allData.count(pair.first) == 0, "Key already exists!");
@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <string>
 #include "Constants.hpp"
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/SharedPointer.hpp"
@@ -150,6 +151,27 @@ bool CompositionalCouplingScheme::hasDataBeenReceived() const
   return hasBeenReceived;
 }
 
+bool CompositionalCouplingScheme::sendDataAhead(DataID dataID)
+{
+  return false;
+}
+
+void CompositionalCouplingScheme::waitForReceivedData(DataID dataID)
+{
+  PRECICE_TRACE(dataID);
+  for (const Scheme &scheme : _couplingSchemes) {
+    scheme.scheme->waitForReceivedData(dataID);
+  }
+}
+
+void CompositionalCouplingScheme::waitForReceivedData()
+{
+  PRECICE_TRACE();
+  for (const Scheme &scheme : _couplingSchemes) {
+    scheme.scheme->waitForReceivedData();
+  }
+}
+
 double CompositionalCouplingScheme::getTime() const
 {
   PRECICE_TRACE();
@@ -300,6 +322,24 @@ std::string CompositionalCouplingScheme::printCouplingState() const
   return state;
 }
 
+void CompositionalCouplingScheme::exportState(const std::string &filenamePrefix) const
+{
+  PRECICE_TRACE(filenamePrefix);
+  int index = 0;
+  for (const Scheme &scheme : _couplingSchemes) {
+    scheme.scheme->exportState(filenamePrefix + "_" + std::to_string(index++));
+  }
+}
+
+void CompositionalCouplingScheme::importState(const std::string &filenamePrefix)
+{
+  PRECICE_TRACE(filenamePrefix);
+  int index = 0;
+  for (const Scheme &scheme : _couplingSchemes) {
+    scheme.scheme->importState(filenamePrefix + "_" + std::to_string(index++));
+  }
+}
+
 bool CompositionalCouplingScheme::determineActiveCouplingSchemes()
 {
   PRECICE_TRACE();
@@ -129,6 +129,20 @@ public:
   /// Returns true, if data has been exchanged in last call of advance().
   virtual bool hasDataBeenReceived() const final override;
 
+  /**
+   * @brief Does not send data ahead.
+   *
+   * Whether a scheme exchanges data in the next call of advance() depends on the other schemes
+   * of the composition, hence the data is sent in advance().
+   */
+  bool sendDataAhead(DataID dataID) final override;
+
+  /// Waits until the given data is available in all coupling schemes.
+  void waitForReceivedData(DataID dataID) final override;
+
+  /// Waits until all data is available in all coupling schemes.
+  void waitForReceivedData() final override;
+
   /**
    * @brief Returns the currently computed time of the coupling scheme.
    *
@@ -215,6 +229,12 @@ public:
   /// Returns a string representation of the current coupling state.
   std::string printCouplingState() const final override;
 
+  /// Exports the state of every composed coupling scheme, appending the index of the scheme to the prefix.
+  void exportState(const std::string &filenamePrefix) const final override;
+
+  /// Imports the state of every composed coupling scheme written by exportState().
+  void importState(const std::string &filenamePrefix) final override;
+
 private:
   mutable logging::Logger _log{"cplscheme::CompositionalCouplingScheme"};
 
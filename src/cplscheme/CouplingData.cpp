@@ -2,6 +2,9 @@
 
 #include <utility>
 
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -90,5 +93,35 @@ void CouplingData::storeExtrapolationData()
   _extrapolation.store(values());
 }
 
+void CouplingData::setCompression(const m2n::Compression &compression)
+{
+  _compression    = compression;
+  _hasCompression = true;
+}
+
+const m2n::Compression *CouplingData::getCompression() const
+{
+  return _hasCompression ? &_compression : nullptr;
+}
+
+void CouplingData::exportState(io::BinaryWriter &writer) const
+{
+  writer.write(values());
+  writer.write(_previousIteration);
+  _extrapolation.exportState(writer);
+}
+
+void CouplingData::importState(io::BinaryReader &reader)
+{
+  const auto size = values().size();
+  reader.read(values());
+  reader.read(_previousIteration);
+  PRECICE_CHECK(values().size() == size && _previousIteration.size() == size,
+                "The checkpoint holds {} values of data \"{}\" on this rank, but the mesh holds {}. "
+                "A checkpoint can only be read with the same partition of the coupling meshes.",
+                values().size(), _data->getName(), size);
+  _extrapolation.importState(reader);
+}
+
 } // namespace cplscheme
 } // namespace precice
\ No newline at end of file
@@ -4,10 +4,17 @@
 #include <vector>
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/impl/Extrapolation.hpp"
+#include "logging/Logger.hpp"
+#include "m2n/Compression.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
+namespace io {
+class BinaryReader;
+class BinaryWriter;
+} // namespace io
+
 namespace cplscheme {
 
 class CouplingData {
@@ -56,7 +63,21 @@ public:
   /// store current value in _extrapolation
   void storeExtrapolationData();
 
+  /// Sets the compression of this data, which overrides the compression of the m2n.
+  void setCompression(const m2n::Compression &compression);
+
+  /// Returns the compression of this data, nullptr if the compression of the m2n is used.
+  const m2n::Compression *getCompression() const;
+
+  /// Writes the values, the values of the previous iteration and the extrapolation samples to a checkpoint.
+  void exportState(io::BinaryWriter &writer) const;
+
+  /// Restores the state written by exportState(), requires the same mesh partition as the exporting run.
+  void importState(io::BinaryReader &reader);
+
 private:
+  logging::Logger _log{"cplscheme::CouplingData"};
+
   /**
    * @brief Default constructor, not to be used!
    *
@@ -80,6 +101,11 @@ private:
 
   /// Mesh associated with this CouplingData
   mesh::PtrMesh _mesh;
+
+  /// Whether _compression overrides the compression of the m2n
+  bool _hasCompression = false;
+
+  m2n::Compression _compression;
 };
 
 } // namespace cplscheme
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include "com/SharedPointer.hpp"
+#include "precice/types.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -131,6 +132,23 @@ public:
   /// actually, this only means that data has been received, data is always sent
   virtual bool hasDataBeenReceived() const = 0;
 
+  /**
+   * @brief Sends the given data before the time window is completed by advance().
+   *
+   * Coupling schemes which support a pipelined exchange start the transfer of the data
+   * as soon as its values are final, such that it overlaps with the mapping of other data.
+   * advance() does not send data again, which has been sent ahead.
+   *
+   * @returns true, if the data is sent ahead of advance()
+   */
+  virtual bool sendDataAhead(DataID dataID) = 0;
+
+  /// Waits until the given data, which is received asynchronously in advance(), is available.
+  virtual void waitForReceivedData(DataID dataID) = 0;
+
+  /// Waits until all data, which is received asynchronously in advance(), is available.
+  virtual void waitForReceivedData() = 0;
+
   /// Returns the currently computed time of the coupling scheme.
   virtual double getTime() const = 0;
 
@@ -184,6 +202,22 @@ public:
 
   /// Returns a string representation of the current coupling state.
   virtual std::string printCouplingState() const = 0;
+
+  /**
+   * @brief Writes the state required for a warm restart to binary files.
+   *
+   * The state comprises time, coupling data, extrapolation samples and acceleration of this rank.
+   * Every coupling scheme writes files starting with the given prefix.
+   */
+  virtual void exportState(const std::string &filenamePrefix) const = 0;
+
+  /**
+   * @brief Restores the state written by exportState().
+   *
+   * @pre initialize() has been called.
+   * @pre advance() has NOT yet been called.
+   */
+  virtual void importState(const std::string &filenamePrefix) = 0;
 };
 
 } // namespace cplscheme
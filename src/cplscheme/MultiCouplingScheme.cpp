@@ -139,14 +139,18 @@ bool MultiCouplingScheme::exchangeDataAndAccelerate()
 }
 
 void MultiCouplingScheme::addDataToSend(
-    const mesh::PtrData &data,
-    mesh::PtrMesh        mesh,
-    bool                 initialize,
-    const std::string &  to)
+    const mesh::PtrData &   data,
+    mesh::PtrMesh           mesh,
+    bool                    initialize,
+    const std::string &     to,
+    const m2n::Compression *compression)
 {
   int id = data->getID();
   PRECICE_DEBUG("Configuring send data to {}", to);
-  PtrCouplingData     ptrCplData(new CouplingData(data, std::move(mesh), initialize, getExtrapolationOrder()));
+  PtrCouplingData ptrCplData(new CouplingData(data, std::move(mesh), initialize, getExtrapolationOrder()));
+  if (compression) {
+    ptrCplData->setCompression(*compression);
+  }
   DataMap::value_type dataPair = std::make_pair(id, ptrCplData);
   _sendDataVector[to].insert(dataPair);
   if (!utils::contained(id, _allData)) {
@@ -155,14 +159,18 @@ void MultiCouplingScheme::addDataToSend(
 }
 
 void MultiCouplingScheme::addDataToReceive(
-    const mesh::PtrData &data,
-    mesh::PtrMesh        mesh,
-    bool                 initialize,
-    const std::string &  from)
+    const mesh::PtrData &   data,
+    mesh::PtrMesh           mesh,
+    bool                    initialize,
+    const std::string &     from,
+    const m2n::Compression *compression)
 {
   int id = data->getID();
   PRECICE_DEBUG("Configuring receive data from {}", from);
-  PtrCouplingData     ptrCplData(new CouplingData(data, std::move(mesh), initialize, getExtrapolationOrder()));
+  PtrCouplingData ptrCplData(new CouplingData(data, std::move(mesh), initialize, getExtrapolationOrder()));
+  if (compression) {
+    ptrCplData->setCompression(*compression);
+  }
   DataMap::value_type dataPair = std::make_pair(id, ptrCplData);
   _receiveDataVector[from].insert(dataPair);
   if (!utils::contained(id, _allData)) {
@@ -6,6 +6,7 @@
 #include "BaseCouplingScheme.hpp"
 #include "cplscheme/Constants.hpp"
 #include "logging/Logger.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "mesh/SharedPointer.hpp"
 
@@ -49,19 +50,25 @@ public:
       int                                maxIterations,
       int                                extrapolationOrder);
 
-  /// Adds data to be sent on data exchange and possibly be modified during coupling iterations.
+  /**
+   * @brief Adds data to be sent on data exchange and possibly be modified during coupling iterations.
+   *
+   * @param[in] compression overrides the compression of the m2n, if given
+   */
   void addDataToSend(
-      const mesh::PtrData &data,
-      mesh::PtrMesh        mesh,
-      bool                 initialize,
-      const std::string &  to);
+      const mesh::PtrData &   data,
+      mesh::PtrMesh           mesh,
+      bool                    initialize,
+      const std::string &     to,
+      const m2n::Compression *compression = nullptr);
 
-  /// Adds data to be received on data exchange.
+  /// Adds data to be received on data exchange, the compression has to match the one of the sender.
   void addDataToReceive(
-      const mesh::PtrData &data,
-      mesh::PtrMesh        mesh,
-      bool                 initialize,
-      const std::string &  from);
+      const mesh::PtrData &   data,
+      mesh::PtrMesh           mesh,
+      bool                    initialize,
+      const std::string &     from,
+      const m2n::Compression *compression = nullptr);
 
   /// returns list of all coupling partners
   std::vector<std::string> getCouplingPartners() const override final;
@@ -1,9 +1,13 @@
 #include "ParallelCouplingScheme.hpp"
 
+#include <algorithm>
 #include <utility>
 
+#include "com/Request.hpp"
 #include "cplscheme/BiCouplingScheme.hpp"
+#include "cplscheme/CouplingData.hpp"
 #include "logging/LogMacros.hpp"
+#include "m2n/M2N.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -52,22 +56,133 @@ void ParallelCouplingScheme::exchangeInitialData()
   }
 }
 
+bool ParallelCouplingScheme::sendDataAhead(DataID dataID)
+{
+  PRECICE_TRACE(dataID);
+  if (not isPipelined() || not doesFirstStep() || not willDataBeExchanged(0.0) || not hasSendData(dataID)) {
+    return false;
+  }
+  _finalData.insert(dataID);
+
+  // Send the data in the order of advance(), which is the order of the receiving participant
+  for (const DataMap::value_type &pair : getSendData()) {
+    if (_sentAheadData.count(pair.first) > 0) {
+      continue;
+    }
+    if (_finalData.count(pair.first) == 0) {
+      break;
+    }
+    if (_sentAheadData.empty()) {
+      _firstSendAheadTime = utils::Event::Clock::now();
+    }
+    PRECICE_DEBUG("Sending data {} ahead...", pair.first);
+    sendData(getM2N(), {pair});
+    _sentAheadData.insert(pair.first);
+  }
+  return true;
+}
+
+void ParallelCouplingScheme::waitForReceivedData(DataID dataID)
+{
+  PRECICE_TRACE(dataID);
+  auto isData = [dataID](const PtrCouplingData &data) { return data->getDataID() == dataID; };
+  if (std::none_of(_pendingReceives.begin(), _pendingReceives.end(), isData)) {
+    return;
+  }
+  // Data arrives in the order of the pending receives
+  bool received = false;
+  while (not received) {
+    received = isData(_pendingReceives.front());
+    completeReceive();
+  }
+}
+
+void ParallelCouplingScheme::waitForReceivedData()
+{
+  PRECICE_TRACE();
+  while (not _pendingReceives.empty()) {
+    completeReceive();
+  }
+}
+
+bool ParallelCouplingScheme::isPipelined() const
+{
+  return _pipelined && not getM2N()->usesPackedExchange();
+}
+
+void ParallelCouplingScheme::startReceive()
+{
+  PRECICE_ASSERT(not _pendingReceives.empty());
+  const PtrCouplingData &  data        = _pendingReceives.front();
+  const m2n::Compression * compression = data->getCompression();
+  PRECICE_DEBUG("Start receiving data {}...", data->getDataID());
+  _receiveRequest   = getM2N()->aReceive(data->values(), data->getMeshID(), data->getDimensions(),
+                                       compression ? *compression : getM2N()->getCompression());
+  _receiveStartTime = utils::Event::Clock::now();
+}
+
+void ParallelCouplingScheme::completeReceive()
+{
+  PRECICE_ASSERT(not _pendingReceives.empty());
+  PRECICE_ASSERT(_receiveRequest);
+  PRECICE_DEBUG("Wait for data {}...", _pendingReceives.front()->getDataID());
+  const auto waitTime = utils::Event::Clock::now();
+  {
+    utils::Event e("pipeline.receiveWait");
+    _receiveRequest->wait();
+  }
+  // The time between the start of the receive and the wait has been used for the mapping of other data
+  utils::Event hidden("pipeline.hiddenReceiveLatency", waitTime - _receiveStartTime);
+  _receiveRequest.reset();
+  _pendingReceives.pop_front();
+  if (not _pendingReceives.empty()) {
+    startReceive();
+  }
+}
+
 bool ParallelCouplingScheme::exchangeDataAndAccelerate()
 {
   bool convergence = true;
 
+  // Data of the last exchange, which has not been waited for, is outdated after this exchange
+  waitForReceivedData();
+
+  // The second participant needs all data for the acceleration, the first participant only sends ahead
+  const bool receivesPipelined = isPipelined() && (doesFirstStep() || isExplicitCouplingScheme());
+
   if (doesFirstStep()) { //first participant
     PRECICE_DEBUG("Sending data...");
-    sendData(getM2N(), getSendData());
+    if (_sentAheadData.empty()) {
+      sendData(getM2N(), getSendData());
+    } else {
+      utils::Event hidden("pipeline.hiddenSendLatency", utils::Event::Clock::now() - _firstSendAheadTime);
+      DataMap remainingData;
+      for (const DataMap::value_type &pair : getSendData()) {
+        if (_sentAheadData.count(pair.first) == 0) {
+          remainingData.insert(pair);
+        }
+      }
+      sendData(getM2N(), remainingData);
+    }
+    _finalData.clear();
+    _sentAheadData.clear();
     PRECICE_DEBUG("Receiving data...");
     if (isImplicitCouplingScheme()) {
       convergence = receiveConvergence(getM2N());
     }
-    receiveData(getM2N(), getReceiveData());
+    if (receivesPipelined) {
+      receiveDataPipelined();
+    } else {
+      receiveData(getM2N(), getReceiveData());
+    }
     checkDataHasBeenReceived();
   } else { //second participant
     PRECICE_DEBUG("Receiving data...");
-    receiveData(getM2N(), getReceiveData());
+    if (receivesPipelined) {
+      receiveDataPipelined();
+    } else {
+      receiveData(getM2N(), getReceiveData());
+    }
     checkDataHasBeenReceived();
     if (isImplicitCouplingScheme()) {
       PRECICE_DEBUG("Perform acceleration (only second participant)...");
@@ -81,5 +196,16 @@ bool ParallelCouplingScheme::exchangeDataAndAccelerate()
   return convergence;
 }
 
+void ParallelCouplingScheme::receiveDataPipelined()
+{
+  PRECICE_ASSERT(_pendingReceives.empty());
+  for (const DataMap::value_type &pair : getReceiveData()) {
+    _pendingReceives.push_back(pair.second);
+  }
+  if (not _pendingReceives.empty()) {
+    startReceive();
+  }
+}
+
 } // namespace cplscheme
 } // namespace precice
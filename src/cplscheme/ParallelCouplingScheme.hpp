@@ -1,11 +1,15 @@
 #pragma once
 
+#include <deque>
+#include <set>
 #include <string>
 #include "BiCouplingScheme.hpp"
+#include "com/SharedPointer.hpp"
 #include "cplscheme/BaseCouplingScheme.hpp"
 #include "cplscheme/Constants.hpp"
 #include "logging/Logger.hpp"
 #include "m2n/SharedPointer.hpp"
+#include "utils/Event.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -56,9 +60,70 @@ public:
       int                           maxIterations      = UNDEFINED_MAX_ITERATIONS,
       int                           extrapolationOrder = UNDEFINED_EXTRAPOLATION_ORDER);
 
+  /**
+   * @brief Enables the pipelined exchange of the data.
+   *
+   * The first participant sends data as soon as it is final, see sendDataAhead(). Received data is
+   * transferred field by field after advance(), as long as the data is not needed for the acceleration.
+   * Only one field per connection is received at once, the next one is requested once the previous
+   * one has been waited for, see waitForReceivedData().
+   * The pipelined exchange is not used if the m2n packs all data of a mesh into one message.
+   */
+  void setPipelined(bool pipelined)
+  {
+    _pipelined = pipelined;
+  }
+
+  /**
+   * @brief Sends the data, if the exchange is pipelined and the first participant completes the time window.
+   *
+   * Data is sent in the order of its IDs, which is the order of the receiving participant.
+   * If data with a lower ID is not final yet, the data is sent once the lower one is.
+   */
+  bool sendDataAhead(DataID dataID) override;
+
+  /// Waits until the received data and all data received before is available.
+  void waitForReceivedData(DataID dataID) override;
+
+  /// Waits until all received data is available.
+  void waitForReceivedData() override;
+
 private:
   logging::Logger _log{"cplscheme::ParallelCouplingScheme"};
 
+  /// True, if the data is exchanged pipelined.
+  bool _pipelined = false;
+
+  /// Data, which is final and will be sent ahead of advance().
+  std::set<DataID> _finalData;
+
+  /// Data, which has been sent ahead of advance().
+  std::set<DataID> _sentAheadData;
+
+  /// Time at which the first data of this time window has been sent ahead.
+  utils::Event::Clock::time_point _firstSendAheadTime;
+
+  /// Data to be received, the first one is received by _receiveRequest.
+  std::deque<PtrCouplingData> _pendingReceives;
+
+  /// Request of the receive of the first pending data.
+  com::PtrRequest _receiveRequest;
+
+  /// Time at which the receive of the first pending data has been started.
+  utils::Event::Clock::time_point _receiveStartTime;
+
+  /// True, if the exchange is pipelined and the m2n sends every data separately.
+  bool isPipelined() const;
+
+  /// Starts receiving the first pending data.
+  void startReceive();
+
+  /// Waits for the first pending data and starts receiving the next one.
+  void completeReceive();
+
+  /// Starts receiving the data field by field, the data is available after waitForReceivedData().
+  void receiveDataPipelined();
+
   /**
    * @brief Exchanges all data between the participants of the ParallelCouplingScheme and applies acceleration.
    * @returns true, if iteration converged
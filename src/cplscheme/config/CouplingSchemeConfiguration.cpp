@@ -22,6 +22,7 @@
 #include "cplscheme/impl/RelativeConvergenceMeasure.hpp"
 #include "cplscheme/impl/ResidualRelativeConvergenceMeasure.hpp"
 #include "logging/LogMacros.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mesh/Data.hpp"
@@ -61,6 +62,8 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_MESH("mesh"),
       ATTR_PARTICIPANT("participant"),
       ATTR_INITIALIZE("initialize"),
+      ATTR_COMPRESSION("compression"),
+      ATTR_COMPRESSION_TOLERANCE("compression-tolerance"),
       ATTR_TYPE("type"),
       ATTR_FIRST("first"),
       ATTR_SECOND("second"),
@@ -75,6 +78,7 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_SUFFICES("suffices"),
       ATTR_STRICT("strict"),
       ATTR_CONTROL("control"),
+      ATTR_PIPELINED("pipelined"),
       VALUE_SERIAL_EXPLICIT("serial-explicit"),
       VALUE_PARALLEL_EXPLICIT("parallel-explicit"),
       VALUE_SERIAL_IMPLICIT("serial-implicit"),
@@ -102,6 +106,7 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
     XMLTag tag(*this, VALUE_PARALLEL_EXPLICIT, occ, TAG);
     tag.setDocumentation("Explicit coupling scheme according to conventional parallel staggered procedure (CPS).");
     addTypespecifcSubtags(VALUE_PARALLEL_EXPLICIT, tag);
+    addPipelinedAttribute(tag);
     tags.push_back(tag);
   }
   {
@@ -116,6 +121,7 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
     tag.setDocumentation("Parallel Implicit coupling scheme according to block Jacobi iterations (V-System). "
                          "Improved implicit iterations are achieved by using a acceleration (recommended!).");
     addTypespecifcSubtags(VALUE_PARALLEL_IMPLICIT, tag);
+    addPipelinedAttribute(tag);
     tags.push_back(tag);
   }
   {
@@ -156,6 +162,9 @@ void CouplingSchemeConfiguration::xmlTagCallback(
   if (tag.getNamespace() == TAG) {
     _config.type = tag.getName();
     _accelerationConfig->clear();
+    if (_config.type == VALUE_PARALLEL_EXPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT) {
+      _config.pipelined = tag.getBooleanAttributeValue(ATTR_PIPELINED);
+    }
   } else if (tag.getName() == TAG_PARTICIPANTS) {
     std::string first = tag.getStringAttributeValue(ATTR_FIRST);
     _config.participants.push_back(first);
@@ -271,7 +280,18 @@ void CouplingSchemeConfiguration::xmlTagCallback(
 
     _meshConfig->addNeededMesh(nameParticipantFrom, nameMesh);
     _meshConfig->addNeededMesh(nameParticipantTo, nameMesh);
-    _config.exchanges.emplace_back(Config::Exchange{exchangeData, exchangeMesh, nameParticipantFrom, nameParticipantTo, initialize});
+    Config::Exchange exchange{exchangeData, exchangeMesh, nameParticipantFrom, nameParticipantTo, initialize};
+    const std::string compressionName = tag.getStringAttributeValue(ATTR_COMPRESSION);
+    if (compressionName != "m2n") {
+      exchange.overridesCompression  = true;
+      exchange.compression.method    = m2n::compressionMethodFromName(compressionName);
+      exchange.compression.tolerance = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE);
+      PRECICE_CHECK(exchange.compression.method != m2n::Compression::Method::Lossy || exchange.compression.tolerance > 0.0,
+                    "A lossy compression requires a positive tolerance. "
+                    "Please set the attribute \"{}\" of the <exchange data=\"{}\" mesh=\"{}\" from=\"{}\" to=\"{}\" /> tag in the <coupling-scheme:... /> of your precice-config.xml.",
+                    ATTR_COMPRESSION_TOLERANCE, nameData, nameMesh, nameParticipantFrom, nameParticipantTo);
+    }
+    _config.exchanges.push_back(exchange);
   } else if (tag.getName() == TAG_MAX_ITERATIONS) {
     PRECICE_ASSERT(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.maxIterations = tag.getIntAttributeValue(ATTR_VALUE);
@@ -489,6 +509,17 @@ void CouplingSchemeConfiguration::addTagParticipants(
   tag.addSubtag(tagParticipants);
 }
 
+void CouplingSchemeConfiguration::addPipelinedAttribute(
+    xml::XMLTag &tag)
+{
+  using namespace xml;
+  XMLAttribute<bool> attrPipelined(ATTR_PIPELINED, false);
+  attrPipelined.setDocumentation("Send every data as soon as it is mapped and receive the data field by field, "
+                                 "such that the communication overlaps with the mapping of the other data. "
+                                 "Has no effect if the m2n packs the data of a mesh into one message.");
+  tag.addAttribute(attrPipelined);
+}
+
 void CouplingSchemeConfiguration::addTagParticipant(
     xml::XMLTag &tag)
 {
@@ -520,6 +551,14 @@ void CouplingSchemeConfiguration::addTagExchange(
   tagExchange.addAttribute(participantTo);
   auto attrInitialize = XMLAttribute<bool>(ATTR_INITIALIZE, false).setDocumentation("Should this data be initialized during initializeData?");
   tagExchange.addAttribute(attrInitialize);
+  auto attrCompression = makeXMLAttribute(ATTR_COMPRESSION, "m2n")
+                             .setDocumentation("Compression of this data, which overrides the compression of the m2n. "
+                                               "Only applies if the m2n does not use a packed exchange.")
+                             .setOptions({"m2n", "none", "lossless", "lossy"});
+  tagExchange.addAttribute(attrCompression);
+  auto attrCompressionTolerance = makeXMLAttribute(ATTR_COMPRESSION_TOLERANCE, 0.0)
+                                      .setDocumentation("Quantization step of the lossy compression of this data.");
+  tagExchange.addAttribute(attrCompressionTolerance);
   tag.addSubtag(tagExchange);
 }
 
@@ -776,6 +815,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelExplicitCouplingSch
       _config.maxTime, _config.maxTimeWindows, _config.timeWindowSize,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Explicit);
+  scheme->setPipelined(_config.pipelined);
 
   addDataToBeExchanged(*scheme, accessor);
 
@@ -834,6 +874,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelImplicitCouplingSch
       _config.maxTime, _config.maxTimeWindows, _config.timeWindowSize,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations, _config.extrapolationOrder);
+  scheme->setPipelined(_config.pipelined);
 
   addDataToBeExchanged(*scheme, accessor);
   PRECICE_CHECK(scheme->hasAnySendData(),
@@ -946,9 +987,10 @@ void CouplingSchemeConfiguration::addDataToBeExchanged(
                   "Please check the <exchange data=\"{}\" mesh=\"{}\" from=\"{}\" to=\"{}\" /> tag in the <coupling-scheme:... /> of your precice-config.xml.",
                   to, dataName, meshName, from, to);
 
-    const bool requiresInitialization = exchange.requiresInitialization;
+    const bool              requiresInitialization = exchange.requiresInitialization;
+    const m2n::Compression *compression            = exchange.overridesCompression ? &exchange.compression : nullptr;
     if (from == accessor) {
-      scheme.addDataToSend(exchange.data, exchange.mesh, requiresInitialization);
+      scheme.addDataToSend(exchange.data, exchange.mesh, requiresInitialization, compression);
       if (requiresInitialization && (_config.type == VALUE_SERIAL_EXPLICIT || _config.type == VALUE_SERIAL_IMPLICIT)) {
         PRECICE_CHECK(not scheme.doesFirstStep(),
                       "In serial coupling only second participant can initialize data and send it. "
@@ -956,7 +998,7 @@ void CouplingSchemeConfiguration::addDataToBeExchanged(
                       dataName, meshName, from, to, requiresInitialization);
       }
     } else if (to == accessor) {
-      scheme.addDataToReceive(exchange.data, exchange.mesh, requiresInitialization);
+      scheme.addDataToReceive(exchange.data, exchange.mesh, requiresInitialization, compression);
       if (requiresInitialization && (_config.type == VALUE_SERIAL_EXPLICIT || _config.type == VALUE_SERIAL_IMPLICIT)) {
         PRECICE_CHECK(scheme.doesFirstStep(),
                       "In serial coupling only first participant can receive initial data. "
@@ -992,11 +1034,12 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
     PRECICE_CHECK((utils::contained(to, _config.participants) || to == _config.controller),
                   "Participant \"{}\" is not configured for coupling scheme", to);
 
-    const bool initialize = exchange.requiresInitialization;
+    const bool              initialize  = exchange.requiresInitialization;
+    const m2n::Compression *compression = exchange.overridesCompression ? &exchange.compression : nullptr;
     if (from == accessor) {
-      scheme.addDataToSend(exchange.data, exchange.mesh, initialize, to);
+      scheme.addDataToSend(exchange.data, exchange.mesh, initialize, to, compression);
     } else if (to == accessor) {
-      scheme.addDataToReceive(exchange.data, exchange.mesh, initialize, from);
+      scheme.addDataToReceive(exchange.data, exchange.mesh, initialize, from, compression);
     }
   }
 }
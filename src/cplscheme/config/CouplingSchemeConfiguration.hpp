@@ -12,6 +12,7 @@
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "precice/config/SharedPointer.hpp"
@@ -98,6 +99,8 @@ private:
   const std::string ATTR_MESH;
   const std::string ATTR_PARTICIPANT;
   const std::string ATTR_INITIALIZE;
+  const std::string ATTR_COMPRESSION;
+  const std::string ATTR_COMPRESSION_TOLERANCE;
   const std::string ATTR_TYPE;
   const std::string ATTR_FIRST;
   const std::string ATTR_SECOND;
@@ -112,6 +115,7 @@ private:
   const std::string ATTR_SUFFICES;
   const std::string ATTR_STRICT;
   const std::string ATTR_CONTROL;
+  const std::string ATTR_PIPELINED;
 
   const std::string VALUE_SERIAL_EXPLICIT;
   const std::string VALUE_PARALLEL_EXPLICIT;
@@ -141,6 +145,7 @@ private:
     double                        timeWindowSize = CouplingScheme::UNDEFINED_TIME_WINDOW_SIZE;
     int                           validDigits    = 16;
     constants::TimesteppingMethod dtMethod       = constants::FIXED_TIME_WINDOW_SIZE;
+    bool                          pipelined      = false;
 
     struct Exchange {
       mesh::PtrData data;
@@ -148,6 +153,9 @@ private:
       std::string   from;
       std::string   to;
       bool          requiresInitialization;
+      /// Whether compression overrides the compression of the m2n
+      bool             overridesCompression = false;
+      m2n::Compression compression;
     };
     std::vector<Exchange>                    exchanges;
     std::vector<ConvergenceMeasureDefintion> convergenceMeasureDefinitions;
@@ -175,6 +183,8 @@ private:
 
   void addTagParticipant(xml::XMLTag &tag);
 
+  void addPipelinedAttribute(xml::XMLTag &tag);
+
   void addTagExchange(xml::XMLTag &tag);
 
   void addTagAbsoluteConvergenceMeasure(xml::XMLTag &tag);
@@ -1,6 +1,8 @@
 #include "Extrapolation.hpp"
 #include <algorithm>
 #include "cplscheme/CouplingScheme.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 
@@ -49,6 +51,35 @@ const Eigen::VectorXd Extrapolation::getInitialGuess()
   return _timeWindowsStorage.col(0);
 }
 
+void Extrapolation::exportState(io::BinaryWriter &writer) const
+{
+  writer.write(_storageIsInitialized);
+  if (_storageIsInitialized) {
+    writer.write(_timeWindowsStorage);
+    writer.write(_numberOfStoredSamples);
+  }
+}
+
+void Extrapolation::importState(io::BinaryReader &reader)
+{
+  bool storageIsInitialized = false;
+  reader.read(storageIsInitialized);
+  PRECICE_CHECK(storageIsInitialized == _storageIsInitialized,
+                "The checkpoint does not match the extrapolation of this coupling scheme. "
+                "A checkpoint can only be read by the participant and coupling scheme that wrote it.");
+  if (not _storageIsInitialized) {
+    return;
+  }
+  const auto rows = _timeWindowsStorage.rows();
+  const auto cols = _timeWindowsStorage.cols();
+  reader.read(_timeWindowsStorage);
+  reader.read(_numberOfStoredSamples);
+  PRECICE_CHECK(_timeWindowsStorage.rows() == rows && _timeWindowsStorage.cols() == cols,
+                "The checkpoint holds extrapolation samples of size {}x{}, but {}x{} are required. "
+                "A checkpoint can only be read with the same extrapolation order and partition of the coupling meshes.",
+                _timeWindowsStorage.rows(), _timeWindowsStorage.cols(), rows, cols);
+}
+
 int Extrapolation::sizeOfSampleStorage()
 {
   PRECICE_ASSERT(_storageIsInitialized);
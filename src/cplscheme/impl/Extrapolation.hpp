@@ -5,6 +5,11 @@
 
 namespace precice {
 
+namespace io {
+class BinaryReader;
+class BinaryWriter;
+} // namespace io
+
 namespace testing {
 // Forward declaration to friend the boost test struct
 class ExtrapolationFixture;
@@ -47,6 +52,12 @@ public:
    */
   const Eigen::VectorXd getInitialGuess();
 
+  /// Writes the stored samples to a checkpoint.
+  void exportState(io::BinaryWriter &writer) const;
+
+  /// Restores the samples written by exportState(), requires an extrapolation initialized in the same way.
+  void importState(io::BinaryReader &reader);
+
 private:
   /// Set by initialize. Used for consistency checks.
   bool _storageIsInitialized = false;
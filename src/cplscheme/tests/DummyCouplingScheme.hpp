@@ -116,6 +116,28 @@ public:
     return false;
   }
 
+  /**
+   * @brief Does not send data ahead.
+   */
+  bool sendDataAhead(DataID dataID) override final
+  {
+    return false;
+  }
+
+  /**
+   * @brief Data is always available.
+   */
+  void waitForReceivedData(DataID dataID) override final
+  { /* Do nothing */
+  }
+
+  /**
+   * @brief Data is always available.
+   */
+  void waitForReceivedData() override final
+  { /* Do nothing */
+  }
+
   /**
    * @brief Not implemented.
    */
@@ -222,6 +244,16 @@ public:
     return std::string();
   }
 
+  /**
+   * @brief Empty.
+   */
+  void exportState(const std::string &filenamePrefix) const override final {}
+
+  /**
+   * @brief Empty.
+   */
+  void importState(const std::string &filenamePrefix) override final {}
+
 private:
   mutable logging::Logger _log{"cplscheme::tests::DummyCouplingScheme"};
 
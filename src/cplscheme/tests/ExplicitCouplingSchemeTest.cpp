@@ -8,6 +8,7 @@
 #include "cplscheme/BaseCouplingScheme.hpp"
 #include "cplscheme/Constants.hpp"
 #include "cplscheme/CouplingScheme.hpp"
+#include "cplscheme/ParallelCouplingScheme.hpp"
 #include "cplscheme/SerialCouplingScheme.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/config/CouplingSchemeConfiguration.hpp"
@@ -656,6 +657,63 @@ BOOST_AUTO_TEST_CASE(testConfiguredExplicitCouplingWithSubcycling)
       *meshConfig);
 }
 
+/// Test that runs on 2 processors.
+BOOST_AUTO_TEST_CASE(testPipelinedParallelExplicitCoupling)
+{
+  PRECICE_TEST("Participant0"_on(1_rank), "Participant1"_on(1_rank), Require::Events);
+  testing::ConnectionOptions options;
+  options.useOnlyMasterCom = true;
+  auto m2n                 = context.connectMasters("Participant0", "Participant1", options);
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, testing::nextMeshID()));
+  mesh->createData("Data0", 1);
+  mesh->createData("Data1", 3);
+  mesh->createData("Data2", 1);
+  mesh->createData("Data3", 3);
+  mesh->createVertex(Eigen::Vector3d::Zero());
+  mesh->createVertex(Eigen::Vector3d::Ones());
+  mesh->allocateDataValues();
+
+  std::string nameParticipant0("Participant0");
+  std::string nameParticipant1("Participant1");
+  cplscheme::ParallelCouplingScheme cplScheme(
+      1.0, 3, 0.1, 12, nameParticipant0, nameParticipant1, context.name, m2n,
+      constants::FIXED_TIME_WINDOW_SIZE, BaseCouplingScheme::Explicit);
+  cplScheme.setPipelined(true);
+
+  // Participant0 sends Data0 and Data1, Participant1 sends Data2 and Data3
+  const bool isFirst = context.isNamed(nameParticipant0);
+  for (int i = 0; i < 4; ++i) {
+    if ((i < 2) == isFirst) {
+      cplScheme.addDataToSend(mesh->data(i), mesh, false);
+    } else {
+      cplScheme.addDataToReceive(mesh->data(i), mesh, false);
+    }
+  }
+  const int firstSend    = isFirst ? 0 : 2;
+  const int firstReceive = isFirst ? 2 : 0;
+
+  cplScheme.initialize(0.0, 1);
+  for (int window = 1; window <= 3; ++window) {
+    mesh->data(firstSend)->values().setConstant(10.0 * window + firstSend);
+    mesh->data(firstSend + 1)->values().setConstant(10.0 * window + firstSend + 1);
+    cplScheme.addComputedTime(0.1);
+
+    // Data is sent in the order of advance(), the second participant sends in advance() only
+    BOOST_TEST(cplScheme.sendDataAhead(mesh->data(firstSend + 1)->getID()) == isFirst);
+    BOOST_TEST(cplScheme.sendDataAhead(mesh->data(firstSend)->getID()) == isFirst);
+    cplScheme.advance();
+    BOOST_TEST(cplScheme.hasDataBeenReceived());
+
+    cplScheme.waitForReceivedData(mesh->data(firstReceive)->getID());
+    BOOST_TEST(mesh->data(firstReceive)->values().isConstant(10.0 * window + firstReceive));
+    cplScheme.waitForReceivedData();
+    BOOST_TEST(mesh->data(firstReceive + 1)->values().isConstant(10.0 * window + firstReceive + 1));
+  }
+  BOOST_TEST(not cplScheme.isCouplingOngoing());
+  cplScheme.finalize();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
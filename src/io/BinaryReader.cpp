@@ -0,0 +1,88 @@
+#include "io/BinaryReader.hpp"
+#include <algorithm>
+#include <cstdint>
+#include "logging/LogMacros.hpp"
+
+namespace precice {
+namespace io {
+
+constexpr char BinaryReader::MAGIC[8];
+
+BinaryReader::BinaryReader(
+    const std::string &filename)
+    : _filename(filename),
+      _file(filename, std::ios::binary)
+{
+  PRECICE_CHECK(_file, "Binary reader failed to open file \"{}\"", filename);
+  char magic[sizeof(MAGIC)];
+  _file.read(magic, sizeof(magic));
+  PRECICE_CHECK(_file && std::equal(magic, magic + sizeof(magic), MAGIC),
+                "File \"{}\" is not a checkpoint written by this version of preCICE.", filename);
+}
+
+void BinaryReader::read(int &value)
+{
+  std::int64_t stored;
+  readBytes(&stored, sizeof(stored));
+  value = static_cast<int>(stored);
+}
+
+void BinaryReader::read(double &value)
+{
+  readBytes(&value, sizeof(value));
+}
+
+void BinaryReader::read(bool &value)
+{
+  int stored;
+  read(stored);
+  value = stored != 0;
+}
+
+void BinaryReader::read(Eigen::MatrixXd &matrix)
+{
+  std::int64_t dimensions[2];
+  readBytes(dimensions, sizeof(dimensions));
+  PRECICE_CHECK(dimensions[0] >= 0 && dimensions[1] >= 0,
+                "Binary reader found a matrix of invalid size {}x{} in file \"{}\".", dimensions[0], dimensions[1], _filename);
+  matrix.resize(dimensions[0], dimensions[1]);
+  readBytes(matrix.data(), matrix.size() * sizeof(double));
+}
+
+void BinaryReader::read(Eigen::VectorXd &vector)
+{
+  Eigen::MatrixXd matrix;
+  read(matrix);
+  PRECICE_CHECK(matrix.cols() == 1 || matrix.size() == 0,
+                "Binary reader expected a vector, but found a matrix with {} columns in file \"{}\".", matrix.cols(), _filename);
+  vector = Eigen::Map<Eigen::VectorXd>(matrix.data(), matrix.size());
+}
+
+void BinaryReader::read(std::vector<int> &values)
+{
+  int size;
+  read(size);
+  PRECICE_CHECK(size >= 0, "Binary reader found a vector of invalid size {} in file \"{}\".", size, _filename);
+  values.resize(size);
+  for (int &value : values) {
+    read(value);
+  }
+}
+
+void BinaryReader::read(std::vector<double> &values)
+{
+  int size;
+  read(size);
+  PRECICE_CHECK(size >= 0, "Binary reader found a vector of invalid size {} in file \"{}\".", size, _filename);
+  values.resize(size);
+  readBytes(values.data(), values.size() * sizeof(double));
+}
+
+void BinaryReader::readBytes(void *data, std::size_t size)
+{
+  _file.read(static_cast<char *>(data), size);
+  PRECICE_CHECK(_file, "Binary reader reached the end of file \"{}\". The checkpoint is truncated or does not match the configuration.", _filename);
+}
+
+} // namespace io
+} // namespace precice
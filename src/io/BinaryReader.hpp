@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Streaming reader for the binary checkpoint format of preCICE.
+ *
+ * The values have to be read in the same order and with the same types as they were written.
+ * Matrices and vectors are resized to the stored dimensions.
+ *
+ * @see BinaryWriter
+ */
+class BinaryReader {
+public:
+  /// Leading bytes of every file, which identify the format and its version
+  static constexpr char MAGIC[8] = {'p', 'r', 'e', 'C', 'I', 'C', 'E', '1'};
+
+  /// Opens the file and checks the header of the format.
+  explicit BinaryReader(const std::string &filename);
+
+  void read(int &value);
+
+  void read(double &value);
+
+  void read(bool &value);
+
+  /// Reads the dimensions and the entries of the matrix.
+  void read(Eigen::MatrixXd &matrix);
+
+  /// Reads a matrix with a single column.
+  void read(Eigen::VectorXd &vector);
+
+  /// Reads the size and the entries of the vector.
+  void read(std::vector<int> &values);
+
+  /// Reads the size and the entries of the vector.
+  void read(std::vector<double> &values);
+
+private:
+  logging::Logger _log{"io::BinaryReader"};
+
+  void readBytes(void *data, std::size_t size);
+
+  std::string _filename;
+
+  std::ifstream _file;
+};
+
+} // namespace io
+} // namespace precice
@@ -0,0 +1,68 @@
+#include "io/BinaryWriter.hpp"
+#include <cstdint>
+#include "io/BinaryReader.hpp"
+#include "logging/LogMacros.hpp"
+
+namespace precice {
+namespace io {
+
+BinaryWriter::BinaryWriter(
+    const std::string &filename)
+    : _filename(filename),
+      _file(filename, std::ios::binary | std::ios::trunc)
+{
+  PRECICE_CHECK(_file, "Binary writer failed to open file \"{}\"", filename);
+  writeBytes(BinaryReader::MAGIC, sizeof(BinaryReader::MAGIC));
+}
+
+void BinaryWriter::write(int value)
+{
+  const std::int64_t stored = value;
+  writeBytes(&stored, sizeof(stored));
+}
+
+void BinaryWriter::write(double value)
+{
+  writeBytes(&value, sizeof(value));
+}
+
+void BinaryWriter::write(bool value)
+{
+  write(static_cast<int>(value));
+}
+
+void BinaryWriter::write(const Eigen::MatrixXd &matrix)
+{
+  const std::int64_t dimensions[] = {matrix.rows(), matrix.cols()};
+  writeBytes(dimensions, sizeof(dimensions));
+  writeBytes(matrix.data(), matrix.size() * sizeof(double));
+}
+
+void BinaryWriter::write(const std::vector<int> &values)
+{
+  write(static_cast<int>(values.size()));
+  for (int value : values) {
+    write(value);
+  }
+}
+
+void BinaryWriter::write(const std::vector<double> &values)
+{
+  write(static_cast<int>(values.size()));
+  writeBytes(values.data(), values.size() * sizeof(double));
+}
+
+void BinaryWriter::flush()
+{
+  _file.flush();
+  PRECICE_CHECK(_file, "Binary writer failed to write to file \"{}\"", _filename);
+}
+
+void BinaryWriter::writeBytes(const void *data, std::size_t size)
+{
+  _file.write(static_cast<const char *>(data), size);
+  PRECICE_CHECK(_file, "Binary writer failed to write to file \"{}\"", _filename);
+}
+
+} // namespace io
+} // namespace precice
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Streaming writer for the binary checkpoint format of preCICE.
+ *
+ * The values are written in the native byte order without any conversion, hence a checkpoint
+ * is only meant to be read by the same build on the same architecture. Matrices are stored
+ * with their dimensions, such that the reader can resize them accordingly.
+ *
+ * @see BinaryReader
+ */
+class BinaryWriter {
+public:
+  /// Opens the file and writes the header of the format.
+  explicit BinaryWriter(const std::string &filename);
+
+  void write(int value);
+
+  void write(double value);
+
+  void write(bool value);
+
+  /// Writes the dimensions and the entries of the matrix.
+  void write(const Eigen::MatrixXd &matrix);
+
+  /// Writes the size and the entries of the vector.
+  void write(const std::vector<int> &values);
+
+  /// Writes the size and the entries of the vector.
+  void write(const std::vector<double> &values);
+
+  /// Flushes the buffer to the file.
+  void flush();
+
+private:
+  logging::Logger _log{"io::BinaryWriter"};
+
+  void writeBytes(const void *data, std::size_t size);
+
+  std::string _filename;
+
+  std::ofstream _file;
+};
+
+} // namespace io
+} // namespace precice
@@ -0,0 +1,65 @@
+#include <Eigen/Core>
+#include <vector>
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+
+using namespace precice;
+using namespace precice::io;
+
+BOOST_AUTO_TEST_CASE(BinaryWriterReaderTest)
+{
+  PRECICE_TEST(1_rank);
+  Eigen::MatrixXd matOutput(2, 3);
+  matOutput << 1, 2, 3, 4, 5, 6.0 / 7.0;
+  Eigen::VectorXd     vecOutput = Eigen::VectorXd::LinSpaced(4, -1.0, 1.0);
+  Eigen::MatrixXd     emptyOutput(0, 5);
+  std::vector<int>    intsOutput{3, -1, 4};
+  std::vector<double> doublesOutput{0.1, 1e-300};
+
+  {
+    BinaryWriter writer("io-BinaryWriterReaderTest.state");
+    writer.write(42);
+    writer.write(1.0 / 3.0);
+    writer.write(true);
+    writer.write(matOutput);
+    writer.write(vecOutput);
+    writer.write(emptyOutput);
+    writer.write(intsOutput);
+    writer.write(doublesOutput);
+  }
+
+  BinaryReader reader("io-BinaryWriterReaderTest.state");
+  int          intInput;
+  double       doubleInput;
+  bool         boolInput;
+  reader.read(intInput);
+  reader.read(doubleInput);
+  reader.read(boolInput);
+  BOOST_TEST(intInput == 42);
+  BOOST_TEST(doubleInput == 1.0 / 3.0);
+  BOOST_TEST(boolInput);
+
+  Eigen::MatrixXd matInput;
+  Eigen::VectorXd vecInput;
+  Eigen::MatrixXd emptyInput;
+  reader.read(matInput);
+  reader.read(vecInput);
+  reader.read(emptyInput);
+  BOOST_TEST(testing::equals(matInput, matOutput));
+  BOOST_TEST(testing::equals(vecInput, vecOutput));
+  BOOST_TEST(emptyInput.rows() == 0);
+  BOOST_TEST(emptyInput.cols() == 5);
+
+  std::vector<int>    intsInput;
+  std::vector<double> doublesInput;
+  reader.read(intsInput);
+  reader.read(doublesInput);
+  BOOST_TEST(intsInput == intsOutput);
+  BOOST_TEST(doublesInput == doublesOutput);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // IOTests
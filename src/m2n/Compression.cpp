@@ -0,0 +1,291 @@
+#include "m2n/Compression.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace m2n {
+
+namespace {
+
+/// Leading byte of an encoded message, which denotes its encoding
+enum Encoding : unsigned char {
+  Plain        = 0,
+  XorRunLength = 1,
+  Quantized    = 2
+};
+
+/// Longest run of the run-length encoding, tokens below maxRun are followed by token+1 literal bytes,
+/// tokens from maxRun on stand for token-maxRun+1 zeros
+constexpr size_t maxRun = 128;
+
+/// Multiples of the tolerance need to be below, such that their differences are exactly representable
+constexpr double maxQuantum = 4503599627370496.0; // 2^52
+
+/// Appends bytes to the storage of a vector of doubles
+class ByteWriter {
+public:
+  explicit ByteWriter(std::vector<double> &storage)
+      : _storage(storage)
+  {
+    _storage.resize(std::max<size_t>(_storage.capacity(), 1));
+  }
+
+  void put(unsigned char byte)
+  {
+    reserve(_size + 1);
+    bytes()[_size++] = byte;
+  }
+
+  void put(void const *data, size_t count)
+  {
+    reserve(_size + count);
+    std::memcpy(bytes() + _size, data, count);
+    _size += count;
+  }
+
+  size_t size() const
+  {
+    return _size;
+  }
+
+  void clear()
+  {
+    _size = 0;
+  }
+
+  /// Shrinks the storage to the written bytes
+  void finish()
+  {
+    _storage.resize((_size + sizeof(double) - 1) / sizeof(double));
+  }
+
+private:
+  unsigned char *bytes()
+  {
+    return reinterpret_cast<unsigned char *>(_storage.data());
+  }
+
+  void reserve(size_t count)
+  {
+    const size_t doubles = (count + sizeof(double) - 1) / sizeof(double);
+    if (doubles > _storage.size()) {
+      _storage.resize(std::max(doubles, 2 * _storage.size()));
+    }
+  }
+
+  std::vector<double> &_storage;
+  size_t               _size = 0;
+};
+
+/// Reads bytes from the storage of doubles
+class ByteReader {
+public:
+  explicit ByteReader(precice::span<double const> storage)
+      : _bytes(reinterpret_cast<unsigned char const *>(storage.data())),
+        _size(storage.size() * sizeof(double))
+  {
+  }
+
+  unsigned char get()
+  {
+    PRECICE_ASSERT(_position < _size, "Encoded message is truncated.");
+    return _bytes[_position++];
+  }
+
+  void get(void *data, size_t count)
+  {
+    PRECICE_ASSERT(_position + count <= _size, "Encoded message is truncated.");
+    std::memcpy(data, _bytes + _position, count);
+    _position += count;
+  }
+
+private:
+  unsigned char const *_bytes;
+  size_t               _size;
+  size_t               _position = 0;
+};
+
+void runLengthEncode(std::vector<unsigned char> const &bytes, ByteWriter &writer)
+{
+  const size_t size = bytes.size();
+  size_t       i    = 0;
+  while (i < size) {
+    size_t zeros = 0;
+    while (i + zeros < size && zeros < maxRun && bytes[i + zeros] == 0) {
+      ++zeros;
+    }
+    if (zeros >= 2) {
+      writer.put(static_cast<unsigned char>(maxRun - 1 + zeros));
+      i += zeros;
+      continue;
+    }
+    // Single zeros are cheaper as part of the literal
+    size_t length = 0;
+    while (i + length < size && length < maxRun &&
+           not(bytes[i + length] == 0 && i + length + 1 < size && bytes[i + length + 1] == 0)) {
+      ++length;
+    }
+    writer.put(static_cast<unsigned char>(length - 1));
+    writer.put(&bytes[i], length);
+    i += length;
+  }
+}
+
+void runLengthDecode(ByteReader &reader, std::vector<unsigned char> &bytes)
+{
+  const size_t size = bytes.size();
+  size_t       i    = 0;
+  while (i < size) {
+    const size_t token = reader.get();
+    if (token >= maxRun) {
+      const size_t zeros = token - maxRun + 1;
+      PRECICE_ASSERT(i + zeros <= size, i, zeros, size);
+      std::fill_n(&bytes[i], zeros, 0);
+      i += zeros;
+    } else {
+      const size_t length = token + 1;
+      PRECICE_ASSERT(i + length <= size, i, length, size);
+      reader.get(&bytes[i], length);
+      i += length;
+    }
+  }
+}
+
+void encodeXorRunLength(precice::span<double const> values, ByteWriter &writer)
+{
+  const size_t               count = values.size();
+  std::vector<unsigned char> planes(count * sizeof(double));
+  std::uint64_t              previous = 0;
+  for (size_t i = 0; i < count; ++i) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &values[i], sizeof(double));
+    const std::uint64_t delta = bits ^ previous;
+    previous                  = bits;
+    for (size_t byte = 0; byte < sizeof(double); ++byte) {
+      planes[byte * count + i] = static_cast<unsigned char>(delta >> (8 * byte));
+    }
+  }
+  runLengthEncode(planes, writer);
+}
+
+void decodeXorRunLength(ByteReader &reader, precice::span<double> values)
+{
+  const size_t               count = values.size();
+  std::vector<unsigned char> planes(count * sizeof(double));
+  runLengthDecode(reader, planes);
+  std::uint64_t previous = 0;
+  for (size_t i = 0; i < count; ++i) {
+    std::uint64_t delta = 0;
+    for (size_t byte = 0; byte < sizeof(double); ++byte) {
+      delta |= static_cast<std::uint64_t>(planes[byte * count + i]) << (8 * byte);
+    }
+    previous = delta ^ previous;
+    std::memcpy(&values[i], &previous, sizeof(double));
+  }
+}
+
+bool isQuantizable(precice::span<double const> values, double tolerance)
+{
+  if (not(tolerance > 0.0)) {
+    return false;
+  }
+  return std::all_of(values.begin(), values.end(), [tolerance](double value) {
+    return std::isfinite(value) && std::abs(value / tolerance) < maxQuantum;
+  });
+}
+
+void encodeQuantized(precice::span<double const> values, double tolerance, ByteWriter &writer)
+{
+  writer.put(&tolerance, sizeof(double));
+  std::int64_t previous = 0;
+  for (double value : values) {
+    const std::int64_t quantum = std::llround(value / tolerance);
+    const std::int64_t delta   = quantum - previous;
+    previous                   = quantum;
+    // Zigzag encoding maps small negative and positive differences to small unsigned numbers
+    std::uint64_t zigzag = (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63);
+    while (zigzag >= 0x80) {
+      writer.put(static_cast<unsigned char>(zigzag | 0x80));
+      zigzag >>= 7;
+    }
+    writer.put(static_cast<unsigned char>(zigzag));
+  }
+}
+
+void decodeQuantized(ByteReader &reader, precice::span<double> values)
+{
+  double tolerance;
+  reader.get(&tolerance, sizeof(double));
+  std::int64_t quantum = 0;
+  for (double &value : values) {
+    std::uint64_t zigzag = 0;
+    int           shift  = 0;
+    unsigned char byte;
+    do {
+      byte = reader.get();
+      zigzag |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    quantum += static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+    value = quantum * tolerance;
+  }
+}
+
+} // namespace
+
+Compression::Method compressionMethodFromName(std::string const &name)
+{
+  if (name == "none") {
+    return Compression::Method::None;
+  } else if (name == "lossless") {
+    return Compression::Method::Lossless;
+  } else if (name == "lossy") {
+    return Compression::Method::Lossy;
+  }
+  logging::Logger _log{"m2n::Compression"};
+  PRECICE_ERROR("Unknown compression method \"{}\". Use one of \"none\", \"lossless\" or \"lossy\".", name);
+}
+
+void compress(precice::span<double const> values, Compression const &compression, std::vector<double> &encoded)
+{
+  ByteWriter writer(encoded);
+  if (compression.method == Compression::Method::Lossy && isQuantizable(values, compression.tolerance)) {
+    writer.put(Quantized);
+    encodeQuantized(values, compression.tolerance, writer);
+  } else {
+    writer.put(XorRunLength);
+    encodeXorRunLength(values, writer);
+    if (writer.size() > 1 + values.size() * sizeof(double)) {
+      writer.clear();
+      writer.put(Plain);
+      writer.put(values.data(), values.size() * sizeof(double));
+    }
+  }
+  writer.finish();
+}
+
+void decompress(precice::span<double const> encoded, precice::span<double> values)
+{
+  ByteReader reader(encoded);
+  switch (reader.get()) {
+  case Plain:
+    reader.get(values.data(), values.size() * sizeof(double));
+    break;
+  case XorRunLength:
+    decodeXorRunLength(reader, values);
+    break;
+  case Quantized:
+    decodeQuantized(reader, values);
+    break;
+  default:
+    PRECICE_ASSERT(false, "Unknown encoding of a compressed message.");
+  }
+}
+
+} // namespace m2n
+} // namespace precice
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "utils/span.hpp"
+
+namespace precice {
+namespace m2n {
+
+/**
+ * @brief Describes how the values of coupling data are encoded for the transfer between participants.
+ *
+ * The lossless method predicts every value by its predecessor and stores the XOR of both bit patterns.
+ * The results are shuffled into byte planes, whose runs of zeros are encoded by their length.
+ * This suits smooth fields, as neighboring values share sign, exponent and leading mantissa bits.
+ *
+ * The lossy method rounds the values to multiples of the tolerance and stores the differences of
+ * neighboring multiples as variable-length integers. The absolute error of every value is at most
+ * half the tolerance, apart from the rounding of the reconstructed value.
+ */
+struct Compression {
+  enum class Method {
+    None,
+    Lossless,
+    Lossy
+  };
+
+  Method method = Method::None;
+
+  /// Quantization step of the lossy method
+  double tolerance = 0.0;
+
+  bool isEnabled() const
+  {
+    return method != Method::None;
+  }
+};
+
+/// Returns the method with the given configuration name, i.e. "none", "lossless" or "lossy".
+Compression::Method compressionMethodFromName(std::string const &name);
+
+/**
+ * @brief Encodes the values with the given compression.
+ *
+ * The bytes are stored in doubles, such that they can be sent by every communication.
+ * The encoding is self-describing: it falls back to the lossless method if a value cannot be quantized,
+ * e.g. NaN, and to the plain values if the lossless method would not reduce the size.
+ *
+ * @param[out] encoded is resized to the encoded size, its capacity is reused
+ */
+void compress(precice::span<double const> values, Compression const &compression, std::vector<double> &encoded);
+
+/// Decodes the values, their number has to match the number of encoded values.
+void decompress(precice::span<double const> encoded, precice::span<double> values);
+
+} // namespace m2n
+} // namespace precice
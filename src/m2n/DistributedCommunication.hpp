@@ -2,6 +2,8 @@
 
 #include <map>
 #include <vector>
+#include "com/SharedPointer.hpp"
+#include "m2n/Compression.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "utils/span.hpp"
@@ -105,11 +107,30 @@ public:
    */
   virtual void closeConnection() = 0;
 
-  /// Sends an array of double values from all slaves (different for each slave).
-  virtual void send(precice::span<double const> itemsToSend, int valueDimension) = 0;
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * The values are encoded with the given compression, the receiver has to use a compression as well.
+   * The send may still be pending on return, the items must not be modified before waitForSendRequests().
+   */
+  virtual void send(precice::span<double const> itemsToSend, int valueDimension, Compression const &compression = Compression()) = 0;
+
+  /**
+   * @brief Waits until all pending sends are completed, such that their items may be modified.
+   *
+   * The default implementation does nothing, as its sends are blocking.
+   */
+  virtual void waitForSendRequests();
 
   /// All slaves receive an array of doubles (different for each slave).
-  virtual void receive(precice::span<double> itemsToReceive, int valueDimension) = 0;
+  virtual void receive(precice::span<double> itemsToReceive, int valueDimension, Compression const &compression = Compression()) = 0;
+
+  /**
+   * @brief Starts receiving an array of doubles, the items are valid after the returned request completed.
+   *
+   * At most one receive may be pending at once. The default implementation defers a blocking receive to the completion.
+   */
+  virtual com::PtrRequest aReceive(precice::span<double> itemsToReceive, int valueDimension, Compression const &compression = Compression());
 
   /*
    * A mapping from remote local ranks to the IDs that must be communicated
@@ -7,6 +7,7 @@
 #include "GatherScatterCommunication.hpp"
 #include "com/Communication.hpp"
 #include "logging/LogMacros.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/Mesh.hpp"
 #include "precice/types.hpp"
@@ -61,7 +62,7 @@ void GatherScatterCommunication::closeConnection()
   _isConnected = false;
 }
 
-void GatherScatterCommunication::send(precice::span<double const> itemsToSend, int valueDimension)
+void GatherScatterCommunication::send(precice::span<double const> itemsToSend, int valueDimension, Compression const &compression)
 {
   PRECICE_TRACE(itemsToSend.size());
 
@@ -103,11 +104,17 @@ void GatherScatterCommunication::send(precice::span<double const> itemsToSend, i
     }
 
     // Send data to other master
-    _com->send(globalItemsToSend, 0);
+    if (compression.isEnabled()) {
+      std::vector<double> encoded;
+      compress(globalItemsToSend, compression, encoded);
+      _com->send(encoded, 0);
+    } else {
+      _com->send(globalItemsToSend, 0);
+    }
   }
 }
 
-void GatherScatterCommunication::receive(precice::span<double> itemsToReceive, int valueDimension)
+void GatherScatterCommunication::receive(precice::span<double> itemsToReceive, int valueDimension, Compression const &compression)
 {
   PRECICE_TRACE(itemsToReceive.size());
 
@@ -118,7 +125,13 @@ void GatherScatterCommunication::receive(precice::span<double> itemsToReceive, i
     int globalSize = _mesh->getGlobalNumberOfVertices() * valueDimension;
     PRECICE_DEBUG("Global Size = {}", globalSize);
     globalItemsToReceive.resize(globalSize);
-    _com->receive(globalItemsToReceive, 0);
+    if (compression.isEnabled()) {
+      std::vector<double> encoded;
+      _com->receive(encoded, 0);
+      decompress(encoded, globalItemsToReceive);
+    } else {
+      _com->receive(globalItemsToReceive, 0);
+    }
   }
 
   // Scatter data
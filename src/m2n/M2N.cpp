@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 #include "DistributedComFactory.hpp"
@@ -18,11 +20,12 @@ extern bool syncMode;
 
 namespace m2n {
 
-M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom, bool useTwoLevelInit)
+M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom, bool useTwoLevelInit, bool usePackedExchange)
     : _masterCom(std::move(masterCom)),
       _distrFactory(std::move(distrFactory)),
       _useOnlyMasterCom(useOnlyMasterCom),
-      _useTwoLevelInit(useTwoLevelInit)
+      _useTwoLevelInit(useTwoLevelInit),
+      _usePackedExchange(usePackedExchange)
 {
 }
 
@@ -210,6 +213,15 @@ void M2N::send(
     precice::span<double const> itemsToSend,
     int                         meshID,
     int                         valueDimension)
+{
+  send(itemsToSend, meshID, valueDimension, _compression);
+}
+
+void M2N::send(
+    precice::span<double const> itemsToSend,
+    int                         meshID,
+    int                         valueDimension,
+    Compression const &         compression)
 {
   if (not _useOnlyMasterCom) {
     PRECICE_ASSERT(_areSlavesConnected);
@@ -223,13 +235,48 @@ void M2N::send(
       _masterCom->send(ack, 0);
     }
     Event e("m2n.sendData", precice::syncMode);
-    _distComs[meshID]->send(itemsToSend, valueDimension);
+    _distComs[meshID]->send(itemsToSend, valueDimension, compression);
   } else {
     PRECICE_ASSERT(_isMasterConnected);
     _masterCom->send(itemsToSend, 0);
   }
 }
 
+void M2N::send(
+    std::vector<precice::span<double const>> const &itemsToSend,
+    int                                             meshID,
+    std::vector<int> const &                        valueDimensions)
+{
+  PRECICE_TRACE(itemsToSend.size(), meshID);
+  PRECICE_ASSERT(itemsToSend.size() == valueDimensions.size(), itemsToSend.size(), valueDimensions.size());
+  if (itemsToSend.empty()) {
+    return;
+  }
+
+  const int    packedDimension = std::accumulate(valueDimensions.begin(), valueDimensions.end(), 0);
+  const size_t vertexCount     = itemsToSend.front().size() / valueDimensions.front();
+
+  // The buffer of the mesh is reused, hence its previous send has to be completed
+  if (not _useOnlyMasterCom) {
+    PRECICE_ASSERT(_distComs.find(meshID) != _distComs.end());
+    _distComs[meshID]->waitForSendRequests();
+  }
+  auto &packedValues = _packedSendValues[meshID];
+  packedValues.resize(vertexCount * packedDimension);
+
+  int offset = 0;
+  for (size_t field = 0; field < itemsToSend.size(); ++field) {
+    const int dimension = valueDimensions[field];
+    PRECICE_ASSERT(itemsToSend[field].size() == vertexCount * dimension, itemsToSend[field].size(), vertexCount, dimension);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+      std::copy_n(&itemsToSend[field][vertex * dimension], dimension, &packedValues[vertex * packedDimension + offset]);
+    }
+    offset += dimension;
+  }
+
+  send(packedValues, meshID, packedDimension);
+}
+
 void M2N::send(bool itemToSend)
 {
   PRECICE_TRACE(utils::MasterSlave::getRank());
@@ -246,6 +293,14 @@ void M2N::send(double itemToSend)
   }
 }
 
+void M2N::waitForSendRequests()
+{
+  PRECICE_TRACE();
+  for (const auto &pair : _distComs) {
+    pair.second->waitForSendRequests();
+  }
+}
+
 void M2N::broadcastSendMesh(mesh::Mesh &mesh)
 {
   MeshID meshID = mesh.getID();
@@ -279,6 +334,14 @@ void M2N::broadcastSend(int &itemToSend, mesh::Mesh &mesh)
 void M2N::receive(precice::span<double> itemsToReceive,
                   int                   meshID,
                   int                   valueDimension)
+{
+  receive(itemsToReceive, meshID, valueDimension, _compression);
+}
+
+void M2N::receive(precice::span<double> itemsToReceive,
+                  int                   meshID,
+                  int                   valueDimension,
+                  Compression const &   compression)
 {
   if (not _useOnlyMasterCom) {
     PRECICE_ASSERT(_areSlavesConnected);
@@ -295,13 +358,67 @@ void M2N::receive(precice::span<double> itemsToReceive,
       }
     }
     Event e("m2n.receiveData", precice::syncMode);
-    _distComs[meshID]->receive(itemsToReceive, valueDimension);
+    _distComs[meshID]->receive(itemsToReceive, valueDimension, compression);
   } else {
     PRECICE_ASSERT(_isMasterConnected);
     _masterCom->receive(itemsToReceive, 0);
   }
 }
 
+com::PtrRequest M2N::aReceive(precice::span<double> itemsToReceive,
+                              int                   meshID,
+                              int                   valueDimension,
+                              Compression const &   compression)
+{
+  if (not _useOnlyMasterCom) {
+    PRECICE_ASSERT(_areSlavesConnected);
+    PRECICE_ASSERT(_distComs.find(meshID) != _distComs.end());
+    PRECICE_ASSERT(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::isSlave()) {
+        bool ack;
+
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+      }
+    }
+    return _distComs[meshID]->aReceive(itemsToReceive, valueDimension, compression);
+  } else {
+    PRECICE_ASSERT(_isMasterConnected);
+    return _masterCom->aReceive(itemsToReceive, 0);
+  }
+}
+
+void M2N::receive(
+    std::vector<precice::span<double>> const &itemsToReceive,
+    int                                       meshID,
+    std::vector<int> const &                  valueDimensions)
+{
+  PRECICE_TRACE(itemsToReceive.size(), meshID);
+  PRECICE_ASSERT(itemsToReceive.size() == valueDimensions.size(), itemsToReceive.size(), valueDimensions.size());
+  if (itemsToReceive.empty()) {
+    return;
+  }
+
+  const int    packedDimension = std::accumulate(valueDimensions.begin(), valueDimensions.end(), 0);
+  const size_t vertexCount     = itemsToReceive.front().size() / valueDimensions.front();
+  _packedReceiveValues.resize(vertexCount * packedDimension);
+
+  receive(_packedReceiveValues, meshID, packedDimension);
+
+  int offset = 0;
+  for (size_t field = 0; field < itemsToReceive.size(); ++field) {
+    const int dimension = valueDimensions[field];
+    PRECICE_ASSERT(itemsToReceive[field].size() == vertexCount * dimension, itemsToReceive[field].size(), vertexCount, dimension);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+      std::copy_n(&_packedReceiveValues[vertex * packedDimension + offset], dimension, &itemsToReceive[field][vertex * dimension]);
+    }
+    offset += dimension;
+  }
+}
+
 void M2N::receive(bool &itemToReceive)
 {
   PRECICE_TRACE(utils::MasterSlave::getRank());
@@ -9,6 +9,7 @@
 #include "SharedPointer.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/SharedPointer.hpp"
 
@@ -30,7 +31,7 @@ struct WhiteboxAccessor;
  */
 class M2N {
 public:
-  M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom = false, bool useTwoLevelInit = false);
+  M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom = false, bool useTwoLevelInit = false, bool usePackedExchange = false);
 
   /// Destructor, empty.
   ~M2N();
@@ -151,6 +152,22 @@ public:
             int                         meshID,
             int                         valueDimension);
 
+  /// Sends an array of double values from all slaves, encoded with the given instead of the default compression.
+  void send(precice::span<double const> itemsToSend,
+            int                         meshID,
+            int                         valueDimension,
+            Compression const &         compression);
+
+  /**
+   * @brief Sends the arrays of double values of several data fields of the same mesh at once.
+   *
+   * The values are interleaved per vertex, such that all fields are sent in a single message
+   * per remote rank. The receiver has to call receive() with fields of the same dimensions.
+   */
+  void send(std::vector<precice::span<double const>> const &itemsToSend,
+            int                                             meshID,
+            std::vector<int> const &                        valueDimensions);
+
   /**
    * @brief The master sends a bool to the other master, for performance reasons, we
    * neglect the gathering and checking step.
@@ -163,6 +180,13 @@ public:
    */
   void send(double itemToSend);
 
+  /**
+   * @brief Waits until all pending sends of data arrays are completed.
+   *
+   * The sent arrays must not be modified before, as the sends may still read them.
+   */
+  void waitForSendRequests();
+
   /// Broadcasts a mesh to connected ranks on remote participant (concerning the given mesh)
   void broadcastSendMesh(mesh::Mesh &mesh);
 
@@ -177,6 +201,27 @@ public:
                int                   meshID,
                int                   valueDimension);
 
+  /// All slaves receive an array of doubles, encoded with the given instead of the default compression.
+  void receive(precice::span<double> itemsToReceive,
+               int                   meshID,
+               int                   valueDimension,
+               Compression const &   compression);
+
+  /**
+   * @brief All slaves start receiving an array of doubles, which is valid after the returned request completed.
+   *
+   * At most one receive per mesh may be pending at once, no other data may be received meanwhile.
+   */
+  com::PtrRequest aReceive(precice::span<double> itemsToReceive,
+                           int                   meshID,
+                           int                   valueDimension,
+                           Compression const &   compression);
+
+  /// All slaves receive the arrays of double values of several data fields of the same mesh at once.
+  void receive(std::vector<precice::span<double>> const &itemsToReceive,
+               int                                       meshID,
+               std::vector<int> const &                  valueDimensions);
+
   /// All slaves receive a bool (the same for each slave).
   void receive(bool &itemToReceive);
 
@@ -200,6 +245,23 @@ public:
     return _useTwoLevelInit;
   }
 
+  /// Returns true, if the data fields of a mesh are exchanged in a single message
+  bool usesPackedExchange() const
+  {
+    return _usePackedExchange;
+  }
+
+  /// Sets the default compression of exchanged data, which is only applied to the distributed communication
+  void setCompression(Compression const &compression)
+  {
+    _compression = compression;
+  }
+
+  Compression const &getCompression() const
+  {
+    return _compression;
+  }
+
 private:
   logging::Logger _log{"m2n::M2N"};
 
@@ -228,6 +290,18 @@ private:
   /// use the two-level initialization concept
   bool _useTwoLevelInit = false;
 
+  /// exchange all data fields of a mesh in a single message
+  bool _usePackedExchange = false;
+
+  /// Default compression of the exchanged data
+  Compression _compression;
+
+  /// Buffers holding the interleaved values of pending packed sends per mesh ID
+  std::map<int, std::vector<double>> _packedSendValues;
+
+  /// Buffer holding the interleaved values of packed receives
+  std::vector<double> _packedReceiveValues;
+
   // @brief To allow access to _useOnlyMasterCom
   friend struct WhiteboxAccessor;
 };
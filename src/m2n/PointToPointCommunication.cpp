@@ -6,7 +6,6 @@
 #include <limits>
 #include <map>
 #include <set>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -14,8 +13,10 @@
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
+#include "com/DeferredRequest.hpp"
 #include "com/Request.hpp"
 #include "logging/LogMacros.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/Mesh.hpp"
 #include "precice/types.hpp"
@@ -58,6 +59,88 @@ void receive(mesh::Mesh::VertexDistribution &m,
   }
 }
 
+namespace {
+
+/// Returns the first index, if the indices are contiguous, otherwise -1
+int contiguousOffset(const std::vector<int> &indices)
+{
+  if (indices.empty()) {
+    return -1;
+  }
+  for (size_t i = 1; i < indices.size(); ++i) {
+    if (indices[i] != indices[0] + static_cast<int>(i)) {
+      return -1;
+    }
+  }
+  return indices[0];
+}
+
+/// Copies the values of the given vertices to the buffer, the loop is unrolled for common value dimensions
+template <int Dimension>
+void gather(const double *values, const std::vector<int> &indices, double *buffer)
+{
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const double *source = values + static_cast<size_t>(indices[i]) * Dimension;
+    for (int d = 0; d < Dimension; ++d) {
+      buffer[i * Dimension + d] = source[d];
+    }
+  }
+}
+
+void gather(const double *values, const std::vector<int> &indices, int valueDimension, double *buffer)
+{
+  switch (valueDimension) {
+  case 1:
+    gather<1>(values, indices, buffer);
+    break;
+  case 2:
+    gather<2>(values, indices, buffer);
+    break;
+  case 3:
+    gather<3>(values, indices, buffer);
+    break;
+  default:
+    for (size_t i = 0; i < indices.size(); ++i) {
+      std::copy_n(values + static_cast<size_t>(indices[i]) * valueDimension, valueDimension, buffer + i * valueDimension);
+    }
+  }
+}
+
+/// Adds the buffered values to the given vertices, the loop is unrolled for common value dimensions
+template <int Dimension>
+void scatterAdd(const double *buffer, const std::vector<int> &indices, double *values)
+{
+  for (size_t i = 0; i < indices.size(); ++i) {
+    double *target = values + static_cast<size_t>(indices[i]) * Dimension;
+    for (int d = 0; d < Dimension; ++d) {
+      target[d] += buffer[i * Dimension + d];
+    }
+  }
+}
+
+void scatterAdd(const double *buffer, const std::vector<int> &indices, int valueDimension, double *values)
+{
+  switch (valueDimension) {
+  case 1:
+    scatterAdd<1>(buffer, indices, values);
+    break;
+  case 2:
+    scatterAdd<2>(buffer, indices, values);
+    break;
+  case 3:
+    scatterAdd<3>(buffer, indices, values);
+    break;
+  default:
+    for (size_t i = 0; i < indices.size(); ++i) {
+      for (int d = 0; d < valueDimension; ++d) {
+        values[static_cast<size_t>(indices[i]) * valueDimension + d] += buffer[i * valueDimension + d];
+      }
+    }
+  }
+}
+
+} // namespace
+
 void broadcastSend(mesh::Mesh::VertexDistribution const &m,
                    const com::PtrCommunication &         communication = utils::MasterSlave::_communication)
 {
@@ -389,8 +472,9 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   for (auto const &comMap : communicationMap) {
     int  globalRequesterRank = comMap.first;
     auto indices             = std::move(communicationMap[globalRequesterRank]);
+    int  offset              = contiguousOffset(indices);
 
-    _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest(), {}});
+    _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest(), {}, offset, {}, {}, {}});
   }
   e4.stop();
   _isConnected = true;
@@ -519,8 +603,9 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   for (auto &i : communicationMap) {
     auto globalAcceptorRank = i.first;
     auto indices            = std::move(i.second);
+    int  offset             = contiguousOffset(indices);
 
-    _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest(), {}});
+    _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest(), {}, offset, {}, {}, {}});
   }
   e4.stop();
   _isConnected = true;
@@ -561,7 +646,9 @@ void PointToPointCommunication::completeSlavesConnection()
   mesh::Mesh::CommunicationMap localCommunicationMap = _mesh->getCommunicationMap();
 
   for (auto &i : _connectionDataVector) {
-    _mappings.push_back({i.remoteRank, std::move(localCommunicationMap[i.remoteRank]), i.request, {}});
+    auto indices = std::move(localCommunicationMap[i.remoteRank]);
+    int  offset  = contiguousOffset(indices);
+    _mappings.push_back({i.remoteRank, std::move(indices), i.request, {}, offset, {}, {}, {}});
   }
 }
 
@@ -572,36 +659,60 @@ void PointToPointCommunication::closeConnection()
   if (not isConnected())
     return;
 
-  checkBufferedRequests(true);
+  waitForSendRequests();
 
-  _communication.reset();
+  // Persistent requests have to be freed before the connection is closed
   _mappings.clear();
+  _communication.reset();
   _connectionDataVector.clear();
   _isConnected = false;
 }
 
-void PointToPointCommunication::send(precice::span<double const> itemsToSend, int valueDimension)
+void PointToPointCommunication::send(precice::span<double const> itemsToSend, int valueDimension, Compression const &compression)
 {
 
   if (_mappings.empty() || itemsToSend.empty()) {
     return;
   }
 
+  // The sends stay pending until waitForSendRequests(), such that both participants may send before receiving
+  if (compression.isEnabled()) {
+    std::vector<double> values;
+    for (auto &mapping : _mappings) {
+      values.resize(mapping.indices.size() * valueDimension);
+      gather(itemsToSend.data(), mapping.indices, valueDimension, values.data());
+      SendSlot &slot    = freeSendSlot(mapping);
+      compress(values, compression, slot.buffer);
+      slot.encodedSize = slot.buffer.size();
+      slot.sizeRequest = _communication->aSend(slot.encodedSize, mapping.remoteRank);
+      slot.request     = _communication->aSend(slot.buffer, mapping.remoteRank);
+    }
+    return;
+  }
+
   for (auto &mapping : _mappings) {
-    auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
-    for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        buffer->push_back(itemsToSend[index * valueDimension + d]);
-      }
+    // A persistent request is only reused if its previous send is completed
+    PersistentExchange *exchange = persistentSend(mapping, valueDimension);
+    if (exchange && exchange->sendRequest->test()) {
+      gather(itemsToSend.data(), mapping.indices, valueDimension, exchange->sendBuffer.data());
+      exchange->sendRequest->start();
+      continue;
     }
-    auto request = _communication->aSend(*buffer, mapping.remoteRank);
-    bufferedRequests.emplace_back(request, buffer);
+
+    const size_t size = mapping.indices.size() * valueDimension;
+    SendSlot &   slot = freeSendSlot(mapping);
+    if (mapping.contiguousOffset >= 0) {
+      // Values of contiguous indices are sent directly from the given items
+      slot.request = _communication->aSend(itemsToSend.subspan(mapping.contiguousOffset * valueDimension, size), mapping.remoteRank);
+      continue;
+    }
+    slot.buffer.resize(size);
+    gather(itemsToSend.data(), mapping.indices, valueDimension, slot.buffer.data());
+    slot.request = _communication->aSend(slot.buffer, mapping.remoteRank);
   }
-  checkBufferedRequests(false);
 }
 
-void PointToPointCommunication::receive(precice::span<double> itemsToReceive, int valueDimension)
+void PointToPointCommunication::receive(precice::span<double> itemsToReceive, int valueDimension, Compression const &compression)
 {
   if (_mappings.empty() || itemsToReceive.empty()) {
     return;
@@ -609,22 +720,69 @@ void PointToPointCommunication::receive(precice::span<double> itemsToReceive, in
 
   std::fill(itemsToReceive.begin(), itemsToReceive.end(), 0.0);
 
+  if (compression.isEnabled()) {
+    // All sizes are sent before the values, hence the receives of the values can be posted at once
+    for (auto &mapping : _mappings) {
+      int encodedSize = 0;
+      _communication->receive(encodedSize, mapping.remoteRank);
+      mapping.encodedBuffer.resize(encodedSize);
+      mapping.request = _communication->aReceive(mapping.encodedBuffer, mapping.remoteRank);
+    }
+    for (auto &mapping : _mappings) {
+      mapping.request->wait();
+      mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
+      decompress(mapping.encodedBuffer, mapping.recvBuffer);
+      scatterAdd(mapping.recvBuffer.data(), mapping.indices, valueDimension, itemsToReceive.data());
+    }
+    return;
+  }
+
+  std::vector<const double *> buffers;
+  buffers.reserve(_mappings.size());
+
   for (auto &mapping : _mappings) {
+    if (PersistentExchange *exchange = persistentReceive(mapping, valueDimension)) {
+      exchange->recvRequest->start();
+      mapping.request = exchange->recvRequest;
+      buffers.push_back(exchange->recvBuffer.data());
+      continue;
+    }
     mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
     mapping.request = _communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
+    buffers.push_back(mapping.recvBuffer.data());
   }
 
-  for (auto &mapping : _mappings) {
-    mapping.request->wait();
+  for (size_t i = 0; i < _mappings.size(); ++i) {
+    _mappings[i].request->wait();
+    scatterAdd(buffers[i], _mappings[i].indices, valueDimension, itemsToReceive.data());
+  }
+}
 
-    int i = 0;
-    for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
-      }
-      i++;
-    }
+com::PtrRequest PointToPointCommunication::aReceive(precice::span<double> itemsToReceive, int valueDimension, Compression const &compression)
+{
+  if (_mappings.empty() || itemsToReceive.empty()) {
+    return std::make_shared<com::DeferredRequest>(std::vector<com::PtrRequest>{}, nullptr);
   }
+
+  if (compression.isEnabled()) {
+    return DistributedCommunication::aReceive(itemsToReceive, valueDimension, compression);
+  }
+
+  // Separate buffers, since the buffers of the mappings may be used by other receives until completion
+  auto                         buffers = std::make_shared<std::vector<std::vector<double>>>(_mappings.size());
+  std::vector<com::PtrRequest> requests;
+  requests.reserve(_mappings.size());
+  for (size_t i = 0; i < _mappings.size(); ++i) {
+    (*buffers)[i].resize(_mappings[i].indices.size() * valueDimension);
+    requests.push_back(_communication->aReceive((*buffers)[i], _mappings[i].remoteRank));
+  }
+
+  return std::make_shared<com::DeferredRequest>(std::move(requests), [this, buffers, itemsToReceive, valueDimension] {
+    std::fill(itemsToReceive.begin(), itemsToReceive.end(), 0.0);
+    for (size_t i = 0; i < _mappings.size(); ++i) {
+      scatterAdd((*buffers)[i].data(), _mappings[i].indices, valueDimension, itemsToReceive.data());
+    }
+  });
 }
 
 void PointToPointCommunication::broadcastSend(const int &itemToSend)
@@ -646,9 +804,13 @@ void PointToPointCommunication::broadcastReceiveAll(std::vector<int> &itemToRece
 
 void PointToPointCommunication::broadcastSendMesh()
 {
+  // The mesh is sent to all connected ranks at once
+  std::vector<com::PtrRequest> requests;
+  requests.reserve(_connectionDataVector.size());
   for (auto &connectionData : _connectionDataVector) {
-    com::CommunicateMesh(_communication).sendMesh(*_mesh, connectionData.remoteRank);
+    requests.push_back(com::CommunicateMesh(_communication).aSendMesh(*_mesh, connectionData.remoteRank));
   }
+  com::Request::wait(requests);
 }
 
 void PointToPointCommunication::broadcastReceiveAllMesh()
@@ -672,21 +834,83 @@ void PointToPointCommunication::gatherAllCommunicationMap(CommunicationMap &loca
   }
 }
 
-void PointToPointCommunication::checkBufferedRequests(bool blocking)
+void PointToPointCommunication::waitForSendRequests()
+{
+  PRECICE_TRACE();
+  for (auto &mapping : _mappings) {
+    for (auto &slot : mapping.sendSlots) {
+      if (slot.sizeRequest) {
+        slot.sizeRequest->wait();
+        slot.sizeRequest.reset();
+      }
+      if (slot.request) {
+        slot.request->wait();
+        slot.request.reset();
+      }
+    }
+    for (auto &exchange : mapping.persistentExchanges) {
+      if (exchange.second.sendRequest) {
+        exchange.second.sendRequest->wait();
+      }
+    }
+  }
+}
+
+PointToPointCommunication::SendSlot &PointToPointCommunication::freeSendSlot(Mapping &mapping)
+{
+  for (auto &slot : mapping.sendSlots) {
+    if ((not slot.sizeRequest || slot.sizeRequest->test()) && (not slot.request || slot.request->test())) {
+      slot.sizeRequest.reset();
+      slot.request.reset();
+      return slot;
+    }
+  }
+  mapping.sendSlots.emplace_back();
+  return mapping.sendSlots.back();
+}
+
+void PointToPointCommunication::setUsePersistentRequests(bool usePersistentRequests)
+{
+  _usePersistentRequests = usePersistentRequests;
+}
+
+PointToPointCommunication::PersistentExchange *PointToPointCommunication::persistentSend(Mapping &mapping, int valueDimension)
 {
-  PRECICE_TRACE(bufferedRequests.size());
-  do {
-    for (auto it = bufferedRequests.begin(); it != bufferedRequests.end();) {
-      if (it->first->test())
-        it = bufferedRequests.erase(it);
-      else
-        ++it;
+  if (not _usePersistentRequests) {
+    return nullptr;
+  }
+  PersistentExchange &exchange = mapping.persistentExchanges[valueDimension];
+  if (not exchange.sendRequest) {
+    // The buffer must not be resized afterwards, as the request is bound to it
+    exchange.sendBuffer.resize(mapping.indices.size() * valueDimension);
+    exchange.sendRequest = _communication->sendInit(exchange.sendBuffer, mapping.remoteRank);
+    if (not exchange.sendRequest) {
+      PRECICE_DEBUG("Persistent requests are not supported by the communication");
+      _usePersistentRequests = false;
+      mapping.persistentExchanges.erase(valueDimension);
+      return nullptr;
     }
-    if (bufferedRequests.empty())
-      return;
-    if (blocking)
-      std::this_thread::yield(); // give up our time slice, so MPI may work
-  } while (blocking);
+  }
+  return &exchange;
+}
+
+PointToPointCommunication::PersistentExchange *PointToPointCommunication::persistentReceive(Mapping &mapping, int valueDimension)
+{
+  if (not _usePersistentRequests) {
+    return nullptr;
+  }
+  PersistentExchange &exchange = mapping.persistentExchanges[valueDimension];
+  if (not exchange.recvRequest) {
+    exchange.recvBuffer.resize(mapping.indices.size() * valueDimension);
+    exchange.recvRequest = _communication->receiveInit(exchange.recvBuffer, mapping.remoteRank);
+    if (not exchange.recvRequest) {
+      PRECICE_DEBUG("Persistent requests are not supported by the communication");
+      _usePersistentRequests = false;
+      mapping.persistentExchanges.erase(valueDimension);
+      return nullptr;
+    }
+  }
+  return &exchange;
 }
 
 } // namespace m2n
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <cstddef>
-#include <list>
+#include <deque>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -39,6 +40,14 @@ public:
   /// Returns true, if a connection to a remote participant has been established.
   bool isConnected() const override;
 
+  /**
+   * @brief Enables persistent requests for the data exchange, enabled by default.
+   *
+   * The requests are created on the first exchange of every value dimension and restarted by all further ones.
+   * They are only used, if the communication supports them (see com::Communication::sendInit()).
+   */
+  void setUsePersistentRequests(bool usePersistentRequests);
+
   /**
    * @brief Accepts connection from participant, which has to call
    *        requestConnection().
@@ -92,14 +101,23 @@ public:
   /**
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
+   *
+   * If enabled, the values for every remote rank are compressed and preceded by the encoded size.
    */
-  void send(precice::span<double const> itemsToSend, int valueDimension = 1) override;
+  void send(precice::span<double const> itemsToSend, int valueDimension = 1, Compression const &compression = Compression()) override;
 
   /**
    * @brief Receives a subset of local double values corresponding to local
    *        indices deduced from the current and remote vertex distributions.
    */
-  void receive(precice::span<double> itemsToReceive, int valueDimension = 1) override;
+  void receive(precice::span<double> itemsToReceive, int valueDimension = 1, Compression const &compression = Compression()) override;
+
+  /**
+   * @brief Posts the receives from all remote ranks at once, the values are added up on completion.
+   *
+   * Compressed values are received on completion, as their size is not known in advance.
+   */
+  com::PtrRequest aReceive(precice::span<double> itemsToReceive, int valueDimension = 1, Compression const &compression = Compression()) override;
 
   /// Broadcasts an int to connected ranks on remote participant
   void broadcastSend(const int &itemToSend) override;
@@ -122,14 +140,30 @@ public:
   /// Gathers a communication maps from connected ranks on remote participant
   void gatherAllCommunicationMap(CommunicationMap &localCommunicationMap) override;
 
+  /// Waits until the pending sends of all mappings are completed, such that the sent items may be modified
+  void waitForSendRequests() override;
+
 private:
   logging::Logger _log{"m2n::PointToPointCommunication"};
 
-  /// Checks all stored requests for completion and removes associated buffers
-  /**
-   * @param[in] blocking False means that the function returns, even when there are requests left.
-   */
-  void checkBufferedRequests(bool blocking);
+  /// Buffers and the persistent requests bound to them, used to exchange data of a given value dimension
+  struct PersistentExchange {
+    std::vector<double> sendBuffer;
+    std::vector<double> recvBuffer;
+    com::PtrRequest     sendRequest;
+    com::PtrRequest     recvRequest;
+  };
+
+  /// Buffer of a pending send, the buffer stays empty if the items are sent directly
+  struct SendSlot {
+    std::vector<double> buffer;
+    int                 encodedSize = 0;
+    com::PtrRequest     sizeRequest;
+    com::PtrRequest     request;
+  };
+
+  /// Whether to exchange data using persistent requests
+  bool _usePersistentRequests = true;
 
   com::PtrCommunicationFactory _communicationFactory;
 
@@ -147,14 +181,35 @@ private:
    *           the current process rank and the remote process rank;
    *        3. Request holding information about pending communication
    *        4. Appropriately sized buffer to receive elements
+   *        5. First local data index, if the local data indices are contiguous, else -1
+   *        6. Persistent requests per value dimension
+   *        7. Pending sends, whose slots are reused once they are completed
    */
   struct Mapping {
     int                 remoteRank;
     std::vector<int>    indices;
     com::PtrRequest     request;
     std::vector<double> recvBuffer;
+    int                 contiguousOffset;
+
+    std::map<int, PersistentExchange> persistentExchanges;
+
+    /// A deque, as pending requests may refer to the encoded size of their slot
+    std::deque<SendSlot> sendSlots;
+
+    /// Received compressed values
+    std::vector<double> encodedBuffer;
   };
 
+  /// Returns a slot of the mapping without pending send
+  SendSlot &freeSendSlot(Mapping &mapping);
+
+  /// Returns the persistent exchange of the mapping with an initialized send request, nullptr if not available
+  PersistentExchange *persistentSend(Mapping &mapping, int valueDimension);
+
+  /// Returns the persistent exchange of the mapping with an initialized receive request, nullptr if not available
+  PersistentExchange *persistentReceive(Mapping &mapping, int valueDimension);
+
   /**
    * @brief Local (for process rank in the current participant) vector of
    *        mappings (one to service each point-to-point connection).
@@ -180,10 +235,6 @@ private:
   std::vector<ConnectionData> _connectionDataVector;
 
   bool _isConnected = false;
-
-  std::list<std::pair<std::shared_ptr<com::Request>,
-                      std::shared_ptr<std::vector<double>>>>
-      bufferedRequests;
 };
 } // namespace m2n
 } // namespace precice
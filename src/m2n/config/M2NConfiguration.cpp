@@ -5,9 +5,11 @@
 #include "com/CommunicationFactory.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "logging/LogMacros.hpp"
+#include "m2n/Compression.hpp"
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
 #include "m2n/M2N.hpp"
@@ -51,6 +53,12 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
                                "for the InfiniBand on SuperMUC. ");
     tag.addAttribute(attrNetwork);
 
+    auto attrNoDelay = makeXMLAttribute(ATTR_NO_DELAY, false)
+                           .setDocumentation(
+                               "Disables Nagle's algorithm (TCP_NODELAY), such that small messages are sent immediately "
+                               "instead of being delayed to be combined with subsequent ones.");
+    tag.addAttribute(attrNoDelay);
+
     auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
                                      .setDocumentation(
                                          "Directory where connection information is exchanged. By default, the "
@@ -85,6 +93,19 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrExchangeDirectory);
     tags.push_back(tag);
   }
+  {
+    XMLTag tag(*this, "shm", occ, TAG);
+    doc = "Communication via POSIX shared memory. Requires both participants to run on the same node.";
+    tag.setDocumentation(doc);
+
+    auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
+                                     .setDocumentation(
+                                         "Directory where connection information is exchanged. By default, the "
+                                         "directory of startup is chosen, and both solvers have to be started "
+                                         "in the same directory.");
+    tag.addAttribute(attrExchangeDirectory);
+    tags.push_back(tag);
+  }
   {
     /// @TODO Remove in Version 3.0
     XMLTag tag(*this, "mpi-singleports", occ, TAG);
@@ -108,6 +129,20 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   attrTwoLevel.setDocumentation("Use a two-level initialization scheme. "
                                 "Recommended for large parallel runs (>5000 MPI ranks).");
 
+  XMLAttribute<bool> attrPacked(ATTR_USE_PACKED_EXCHANGE, false);
+  attrPacked.setDocumentation("Exchange all data of a mesh in a single message per connected rank, instead of one message per data. "
+                              "Recommended if several data fields are exchanged on the same mesh.");
+
+  auto attrCompression = makeXMLAttribute(ATTR_COMPRESSION, "none")
+                             .setDocumentation("Compression of the exchanged data. \"lossless\" reconstructs the data exactly, "
+                                               "\"lossy\" rounds the data to multiples of the compression tolerance. "
+                                               "Recommended for large meshes with smooth data and a limited network bandwidth.")
+                             .setOptions({"none", "lossless", "lossy"});
+
+  auto attrCompressionTolerance = makeXMLAttribute(ATTR_COMPRESSION_TOLERANCE, 0.0)
+                                      .setDocumentation("Quantization step of the lossy compression. "
+                                                        "The absolute error of every exchanged value is at most half of it.");
+
   auto attrFrom = XMLAttribute<std::string>("from")
                       .setDocumentation(
                           "First participant name involved in communication. For performance reasons, we recommend to use "
@@ -120,6 +155,9 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrTo);
     tag.addAttribute(attrEnforce);
     tag.addAttribute(attrTwoLevel);
+    tag.addAttribute(attrPacked);
+    tag.addAttribute(attrCompression);
+    tag.addAttribute(attrCompressionTolerance);
     parent.addSubtag(tag);
   }
 }
@@ -153,6 +191,14 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     checkDuplicates(from, to);
     bool enforceGatherScatter = tag.getBooleanAttributeValue(ATTR_ENFORCE_GATHER_SCATTER);
     bool useTwoLevelInit      = tag.getBooleanAttributeValue(ATTR_USE_TWO_LEVEL_INIT);
+    bool usePackedExchange    = tag.getBooleanAttributeValue(ATTR_USE_PACKED_EXCHANGE);
+
+    Compression compression;
+    compression.method    = compressionMethodFromName(tag.getStringAttributeValue(ATTR_COMPRESSION));
+    compression.tolerance = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE);
+    PRECICE_CHECK(compression.method != Compression::Method::Lossy || compression.tolerance > 0.0,
+                  "A lossy compression requires a positive tolerance. Please set the attribute \"{}\" of the m2n between \"{}\" and \"{}\".",
+                  ATTR_COMPRESSION_TOLERANCE, from, to);
 
     if (enforceGatherScatter && useTwoLevelInit) {
       throw std::runtime_error{std::string{"A gather-scatter m2n communication cannot use two-level initialization. Please switch either "} + "\"" + ATTR_ENFORCE_GATHER_SCATTER + "\" or \"" + ATTR_USE_TWO_LEVEL_INIT + "\" off."};
@@ -171,9 +217,10 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
       PRECICE_CHECK(not utils::isTruncated<unsigned short>(port),
                     "The value given for the \"port\" attribute is not a 16-bit unsigned integer: {}", port);
 
-      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
-      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
-      com             = comFactory->newCommunication();
+      std::string dir     = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+      bool        noDelay = tag.getBooleanAttributeValue(ATTR_NO_DELAY);
+      comFactory          = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir, noDelay);
+      com                 = comFactory->newCommunication();
     } else if (tagName == "mpi-multiple-ports") {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
 #ifdef PRECICE_NO_MPI
@@ -202,6 +249,10 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
       comFactory = std::make_shared<com::MPISinglePortsCommunicationFactory>(dir);
       com        = comFactory->newCommunication();
 #endif
+    } else if (tagName == "shm") {
+      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+      comFactory      = std::make_shared<com::SharedMemoryCommunicationFactory>(dir);
+      com             = comFactory->newCommunication();
     }
 
     PRECICE_ASSERT(com.get() != nullptr);
@@ -214,7 +265,8 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     }
     PRECICE_ASSERT(distrFactory.get() != nullptr);
 
-    auto m2n = std::make_shared<m2n::M2N>(com, distrFactory, false, useTwoLevelInit);
+    auto m2n = std::make_shared<m2n::M2N>(com, distrFactory, false, useTwoLevelInit, usePackedExchange);
+    m2n->setCompression(compression);
     _m2ns.emplace_back(m2n, from, to);
   }
 }
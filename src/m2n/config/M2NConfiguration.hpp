@@ -53,6 +53,10 @@ private:
   const std::string ATTR_EXCHANGE_DIRECTORY     = "exchange-directory";
   const std::string ATTR_ENFORCE_GATHER_SCATTER = "enforce-gather-scatter";
   const std::string ATTR_USE_TWO_LEVEL_INIT     = "use-two-level-initialization";
+  const std::string ATTR_USE_PACKED_EXCHANGE    = "use-packed-exchange";
+  const std::string ATTR_NO_DELAY               = "no-delay";
+  const std::string ATTR_COMPRESSION            = "compression";
+  const std::string ATTR_COMPRESSION_TOLERANCE  = "compression-tolerance";
 
   std::vector<M2NTuple> _m2ns;
 
@@ -0,0 +1,251 @@
+#ifndef PRECICE_NO_MPI
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <vector>
+#include "com/SocketCommunicationFactory.hpp"
+#include "m2n/Compression.hpp"
+#include "m2n/PointToPointCommunication.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(Compression)
+
+using namespace precice;
+using m2n::Compression;
+
+namespace {
+
+/// A smooth field like it results from a simulation, sampled on a line of vertices
+std::vector<double> smoothField(size_t size)
+{
+  std::vector<double> values(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double x = 1e-3 * i;
+    values[i]      = 1e5 + 250.0 * std::sin(x) * std::cos(0.3 * x);
+  }
+  return values;
+}
+
+bool bitwiseEqual(std::vector<double> const &a, std::vector<double> const &b)
+{
+  return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(LosslessIsExact)
+{
+  PRECICE_TEST(1_rank);
+  Compression compression;
+  compression.method = Compression::Method::Lossless;
+
+  std::vector<double> values = smoothField(1000);
+  values[10]                 = std::numeric_limits<double>::quiet_NaN();
+  values[11]                 = -std::numeric_limits<double>::infinity();
+  values[12]                 = -0.0;
+  values[13]                 = std::numeric_limits<double>::denorm_min();
+
+  std::vector<double> encoded;
+  m2n::compress(values, compression, encoded);
+  BOOST_TEST(encoded.size() < values.size());
+
+  std::vector<double> decoded(values.size());
+  m2n::decompress(encoded, decoded);
+  BOOST_TEST(bitwiseEqual(decoded, values));
+}
+
+BOOST_AUTO_TEST_CASE(LosslessFallsBackToPlain)
+{
+  PRECICE_TEST(1_rank);
+  Compression compression;
+  compression.method = Compression::Method::Lossless;
+
+  // Values without any common bits do not compress
+  std::vector<double> values(100);
+  std::uint64_t       state = 88172645463325252ull;
+  for (double &value : values) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    std::memcpy(&value, &state, sizeof(double));
+  }
+
+  std::vector<double> encoded;
+  m2n::compress(values, compression, encoded);
+  BOOST_TEST(encoded.size() == values.size() + 1);
+
+  std::vector<double> decoded(values.size());
+  m2n::decompress(encoded, decoded);
+  BOOST_TEST(bitwiseEqual(decoded, values));
+}
+
+BOOST_AUTO_TEST_CASE(LossyRespectsTolerance)
+{
+  PRECICE_TEST(1_rank);
+  Compression compression;
+  compression.method    = Compression::Method::Lossy;
+  compression.tolerance = 1e-3;
+
+  const std::vector<double> values = smoothField(1000);
+  std::vector<double>       encoded;
+  m2n::compress(values, compression, encoded);
+  BOOST_TEST(encoded.size() < values.size() / 2);
+
+  std::vector<double> decoded(values.size());
+  m2n::decompress(encoded, decoded);
+  for (size_t i = 0; i < values.size(); ++i) {
+    BOOST_TEST(std::abs(decoded[i] - values[i]) <= 0.5 * compression.tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LossyFallsBackToLossless)
+{
+  PRECICE_TEST(1_rank);
+  Compression compression;
+  compression.method    = Compression::Method::Lossy;
+  compression.tolerance = 1e-3;
+
+  std::vector<double> values = smoothField(100);
+  values[50]                 = std::numeric_limits<double>::infinity();
+
+  std::vector<double> encoded;
+  m2n::compress(values, compression, encoded);
+  std::vector<double> decoded(values.size());
+  m2n::decompress(encoded, decoded);
+  BOOST_TEST(bitwiseEqual(decoded, values));
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PRECICE_TEST(1_rank);
+  Compression compression;
+  compression.method = Compression::Method::Lossless;
+
+  std::vector<double> encoded;
+  m2n::compress(std::vector<double>{}, compression, encoded);
+  BOOST_TEST(encoded.size() == 1);
+  std::vector<double> decoded;
+  m2n::decompress(encoded, decoded);
+}
+
+BOOST_AUTO_TEST_CASE(PointToPoint)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+
+  mesh::PtrMesh                mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  const std::map<int, std::vector<int>> distributionA{{0, {0, 1, 2, 3}}, {1, {4, 5, 6, 7}}};
+  const std::map<int, std::vector<int>> distributionB{{0, {2, 3, 4, 5}}, {1, {0, 1, 6, 7}}};
+  const auto &                          distribution = context.isNamed("A") ? distributionA : distributionB;
+  if (context.isMaster()) {
+    mesh->setGlobalNumberOfVertices(8);
+    mesh->getVertexDistribution() = distribution;
+  }
+
+  Compression lossless;
+  lossless.method = Compression::Method::Lossless;
+  Compression lossy;
+  lossy.method    = Compression::Method::Lossy;
+  lossy.tolerance = 0.1;
+
+  constexpr int  valueDimension = 2;
+  auto           value          = [](int vertex, int d) { return 1.0 / 3.0 * vertex + 0.01 * d; };
+  const auto &   localVertices  = distribution.at(context.rank);
+  std::vector<double> expected;
+  for (int vertex : localVertices) {
+    for (int d = 0; d < valueDimension; ++d) {
+      expected.push_back(value(vertex, d));
+    }
+  }
+
+  if (context.isNamed("A")) {
+    c.requestConnection("B", "A");
+    c.send(expected, valueDimension, lossless);
+    c.send(expected, valueDimension, lossy);
+    c.waitForSendRequests();
+  } else {
+    c.acceptConnection("B", "A");
+    std::vector<double> received(expected.size());
+    c.receive(received, valueDimension, lossless);
+    BOOST_TEST(bitwiseEqual(received, expected));
+
+    c.receive(received, valueDimension, lossy);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      BOOST_TEST(std::abs(received[i] - expected[i]) <= 0.5 * lossy.tolerance);
+    }
+  }
+}
+
+/// Reports the compression ratio, the throughput of the encoding and the time of point-to-point exchanges
+BOOST_AUTO_TEST_CASE(Benchmark)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  constexpr int vertexCount = 200000;
+  constexpr int exchanges   = 5;
+
+  mesh::PtrMesh                mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  std::map<int, std::vector<int>> distribution;
+  for (int vertex = 0; vertex < vertexCount; ++vertex) {
+    distribution[2 * vertex / vertexCount].push_back(vertex);
+  }
+  if (context.isMaster()) {
+    mesh->setGlobalNumberOfVertices(vertexCount);
+    mesh->getVertexDistribution() = distribution;
+  }
+  if (context.isNamed("A")) {
+    c.requestConnection("B", "A");
+  } else {
+    c.acceptConnection("B", "A");
+  }
+
+  const std::vector<double> values = smoothField(vertexCount / 2);
+  std::vector<double>       received(values.size());
+
+  Compression none, lossless, lossy;
+  lossless.method = Compression::Method::Lossless;
+  lossy.method    = Compression::Method::Lossy;
+  lossy.tolerance = 1e-6;
+
+  for (auto const &named : {std::make_pair("none    ", none), std::make_pair("lossless", lossless), std::make_pair("lossy   ", lossy)}) {
+    auto const &compression = named.second;
+
+    std::vector<double> encoded;
+    auto                start = std::chrono::steady_clock::now();
+    m2n::compress(values, compression, encoded);
+    const std::chrono::duration<double> encoding = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < exchanges; ++i) {
+      if (context.isNamed("A")) {
+        c.send(values, 1, compression);
+        c.receive(received, 1, compression);
+      } else {
+        c.receive(received, 1, compression);
+        c.send(received, 1, compression);
+      }
+      c.waitForSendRequests();
+    }
+    const std::chrono::duration<double, std::milli> exchange = std::chrono::steady_clock::now() - start;
+
+    BOOST_TEST_MESSAGE(named.first << " ratio: " << static_cast<double>(encoded.size()) / values.size()
+                                   << " encoding [MB/s]: " << values.size() * sizeof(double) / encoding.count() / 1e6
+                                   << " time per round trip [ms]: " << exchange.count() / exchanges);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Compression
+BOOST_AUTO_TEST_SUITE_END() // M2NTests
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,139 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include <chrono>
+#include <vector>
+#include "m2n/M2N.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/span.hpp"
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(PackedExchange)
+
+using namespace precice;
+using namespace m2n;
+
+BOOST_AUTO_TEST_CASE(GatherScatter)
+{
+  PRECICE_TEST("Part1"_on(1_rank), "Part2"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  testing::ConnectionOptions options;
+  options.usePackedExchange = true;
+  auto m2n                  = context.connectMasters("Part1", "Part2", options);
+  BOOST_TEST(m2n->usesPackedExchange());
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+  m2n->createDistributedCommunication(mesh);
+  const std::vector<int> dimensions{1, 2};
+
+  if (context.isNamed("Part1")) {
+    mesh->setGlobalNumberOfVertices(4);
+    mesh->getVertexDistribution()[0] = {0, 1, 2, 3};
+    m2n->acceptSlavesConnection("Part1", "Part2");
+
+    Eigen::VectorXd scalars(4);
+    scalars << 1.0, 2.0, 3.0, 4.0;
+    Eigen::VectorXd vectors(8);
+    vectors << 10.0, 11.0, 20.0, 21.0, 30.0, 31.0, 40.0, 41.0;
+    m2n->send({scalars, vectors}, mesh->getID(), dimensions);
+
+    Eigen::VectorXd receivedScalars = Eigen::VectorXd::Zero(4);
+    Eigen::VectorXd receivedVectors = Eigen::VectorXd::Zero(8);
+    m2n->receive({receivedScalars, receivedVectors}, mesh->getID(), dimensions);
+    BOOST_TEST(testing::equals(receivedScalars, Eigen::VectorXd(2 * scalars)));
+    BOOST_TEST(testing::equals(receivedVectors, Eigen::VectorXd(2 * vectors)));
+  } else {
+    m2n->requestSlavesConnection("Part1", "Part2");
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(4);
+      mesh->getVertexDistribution()[0] = {0, 1};
+      mesh->getVertexDistribution()[1] = {2, 3};
+    }
+
+    Eigen::VectorXd scalars = Eigen::VectorXd::Zero(2);
+    Eigen::VectorXd vectors = Eigen::VectorXd::Zero(4);
+    m2n->receive({scalars, vectors}, mesh->getID(), dimensions);
+
+    Eigen::VectorXd expectedScalars(2);
+    Eigen::VectorXd expectedVectors(4);
+    if (context.isMaster()) {
+      expectedScalars << 1.0, 2.0;
+      expectedVectors << 10.0, 11.0, 20.0, 21.0;
+    } else {
+      expectedScalars << 3.0, 4.0;
+      expectedVectors << 30.0, 31.0, 40.0, 41.0;
+    }
+    BOOST_TEST(testing::equals(scalars, expectedScalars));
+    BOOST_TEST(testing::equals(vectors, expectedVectors));
+
+    scalars *= 2;
+    vectors *= 2;
+    m2n->send({scalars, vectors}, mesh->getID(), dimensions);
+  }
+}
+
+/// Compares the time of exchanging 1 to 10 data fields with one message per field and with a single packed message
+BOOST_AUTO_TEST_CASE(Benchmark)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  constexpr int vertexCount = 1000;
+  constexpr int exchanges   = 50;
+
+  for (bool packed : {false, true}) {
+    testing::ConnectionOptions options;
+    options.useOnlyMasterCom  = true;
+    options.usePackedExchange = packed;
+    auto m2n                  = context.connectMasters("A", "B", options);
+
+    for (int fieldCount = 1; fieldCount <= 10; ++fieldCount) {
+      std::vector<Eigen::VectorXd> fields(fieldCount, Eigen::VectorXd::Constant(vertexCount, context.isNamed("A") ? 1.0 : 0.0));
+      std::vector<precice::span<double const>> sendValues(fields.begin(), fields.end());
+      std::vector<precice::span<double>>       receiveValues(fields.begin(), fields.end());
+      const std::vector<int>                   dimensions(fieldCount, 1);
+
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < exchanges; ++i) {
+        if (context.isNamed("A")) {
+          if (packed) {
+            m2n->send(sendValues, 0, dimensions);
+            m2n->receive(receiveValues, 0, dimensions);
+          } else {
+            for (auto &field : fields) {
+              m2n->send(field, 0, 1);
+            }
+            for (auto &field : fields) {
+              m2n->receive(field, 0, 1);
+            }
+          }
+        } else {
+          if (packed) {
+            m2n->receive(receiveValues, 0, dimensions);
+            m2n->send(sendValues, 0, dimensions);
+          } else {
+            for (auto &field : fields) {
+              m2n->receive(field, 0, 1);
+            }
+            for (auto &field : fields) {
+              m2n->send(field, 0, 1);
+            }
+          }
+        }
+      }
+      const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+      for (const auto &field : fields) {
+        BOOST_TEST(field.isConstant(1.0));
+      }
+      BOOST_TEST_MESSAGE((packed ? "packed  " : "unpacked") << " fields: " << fieldCount
+                                                            << " messages per exchange: " << (packed ? 1 : fieldCount)
+                                                            << " time per round trip [us]: " << elapsed.count() / exchanges);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PackedExchange
+BOOST_AUTO_TEST_SUITE_END() // M2NTests
+
+#endif // PRECICE_NO_MPI
@@ -2,10 +2,13 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <vector>
 #include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/DistributedCommunication.hpp"
@@ -106,6 +109,8 @@ void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
     c.requestConnection("B", "A");
 
     c.send(data);
+    // The data is received into the sent values
+    c.waitForSendRequests();
     c.receive(data);
 
     BOOST_TEST(testing::equals(data, expectedData));
@@ -116,6 +121,7 @@ void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
     BOOST_TEST(testing::equals(data, expectedData));
     process(data);
     c.send(data);
+    c.waitForSendRequests();
   }
 }
 
@@ -182,6 +188,8 @@ void runP2PComTest2(const TestContext &context, com::PtrCommunicationFactory cf)
     c.requestConnection("B", "A");
 
     c.send(data);
+    // The data is received into the sent values
+    c.waitForSendRequests();
     c.receive(data);
     BOOST_TEST(testing::equals(data, expectedData));
   } else {
@@ -191,6 +199,163 @@ void runP2PComTest2(const TestContext &context, com::PtrCommunicationFactory cf)
     BOOST_TEST(testing::equals(data, expectedData));
     process(data);
     c.send(data);
+    c.waitForSendRequests();
+  }
+}
+
+/// sends several vector-valued data fields in a row, mixing contiguous and non-contiguous local indices
+void runP2PComVectorTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  const std::map<int, vector<int>> distributionA{{0, {0, 1, 3, 5, 7}}, {1, {1, 2, 4, 5, 6}}};
+  const std::map<int, vector<int>> distributionB{{0, {1, 2, 5, 6}}, {1, {0, 1, 3, 4, 5, 7}}};
+  const auto &                     distribution = context.isNamed("A") ? distributionA : distributionB;
+
+  if (context.isMaster()) {
+    mesh->setGlobalNumberOfVertices(8);
+    mesh->getVertexDistribution() = distribution;
+  }
+
+  constexpr int valueDimension = 3;
+  constexpr int fieldCount     = 3;
+  // The value of a global vertex, vertices 1 and 5 are held by both ranks of A
+  auto value = [](int field, int vertex, int d) { return 100.0 * field + 10.0 * vertex + d; };
+
+  const auto &           localVertices = distribution.at(context.rank);
+  vector<vector<double>> fields(fieldCount, vector<double>(localVertices.size() * valueDimension, -1));
+
+  if (context.isNamed("A")) {
+    c.requestConnection("B", "A");
+    for (int field = 0; field < fieldCount; ++field) {
+      for (size_t i = 0; i < localVertices.size(); ++i) {
+        for (int d = 0; d < valueDimension; ++d) {
+          fields[field][i * valueDimension + d] = value(field, localVertices[i], d);
+        }
+      }
+      c.send(fields[field], valueDimension);
+    }
+    c.waitForSendRequests();
+  } else {
+    c.acceptConnection("B", "A");
+    for (int field = 0; field < fieldCount; ++field) {
+      c.receive(fields[field], valueDimension);
+    }
+    for (int field = 0; field < fieldCount; ++field) {
+      vector<double> expectedData;
+      for (int vertex : localVertices) {
+        const double multiplicity = (vertex == 1 || vertex == 5) ? 2.0 : 1.0;
+        for (int d = 0; d < valueDimension; ++d) {
+          expectedData.push_back(multiplicity * value(field, vertex, d));
+        }
+      }
+      BOOST_TEST(testing::equals(fields[field], expectedData));
+    }
+  }
+}
+
+/// Exchanges data back and forth with and without persistent requests and reports the time per round trip
+void runP2PPersistentRequestsTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+  constexpr int vertexCount = 1000;
+  constexpr int exchanges   = 100;
+
+  for (bool persistent : {false, true}) {
+    mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+    m2n::PointToPointCommunication c(cf, mesh);
+    c.setUsePersistentRequests(persistent);
+
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(2 * vertexCount);
+      vector<int> first(vertexCount), second(vertexCount);
+      std::iota(first.begin(), first.end(), 0);
+      std::iota(second.begin(), second.end(), vertexCount);
+      mesh->getVertexDistribution() = {{0, first}, {1, second}};
+    }
+
+    if (context.isNamed("A")) {
+      c.requestConnection("B", "A");
+    } else {
+      c.acceptConnection("B", "A");
+    }
+
+    vector<double> data(vertexCount, context.isNamed("A") ? 1.0 : 0.0);
+    const auto     start = std::chrono::steady_clock::now();
+    for (int i = 0; i < exchanges; ++i) {
+      if (context.isNamed("A")) {
+        c.send(data, 1);
+        c.waitForSendRequests();
+        std::fill(data.begin(), data.end(), 0.0);
+        c.receive(data, 1);
+      } else {
+        c.receive(data, 1);
+        c.send(data, 1);
+        c.waitForSendRequests();
+        std::fill(data.begin(), data.end(), 0.0);
+      }
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (context.isNamed("A")) {
+      BOOST_TEST(std::all_of(data.begin(), data.end(), [](double value) { return value == 1.0; }));
+    }
+    BOOST_TEST_MESSAGE((persistent ? "persistent    " : "non-persistent") << " time per round trip [us]: " << elapsed.count() / exchanges);
+  }
+}
+
+/// Both participants send several large data fields before receiving them, as the parallel coupling schemes do
+void runP2PSendBeforeReceiveTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+  constexpr int vertexCount = 20000;
+  constexpr int fieldCount  = 3;
+
+  mesh::PtrMesh                  mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  // A holds contiguous blocks of vertices, B alternating vertices, such that direct and buffered sends are mixed
+  std::map<int, vector<int>> distribution;
+  for (int vertex = 0; vertex < vertexCount; ++vertex) {
+    const int rank = context.isNamed("A") ? vertex / (vertexCount / 2) : vertex % 2;
+    distribution[rank].push_back(vertex);
+  }
+  if (context.isMaster()) {
+    mesh->setGlobalNumberOfVertices(vertexCount);
+    mesh->getVertexDistribution() = distribution;
+  }
+
+  if (context.isNamed("A")) {
+    c.requestConnection("B", "A");
+  } else {
+    c.acceptConnection("B", "A");
+  }
+
+  auto        value         = [](bool fromA, int field, int vertex) { return (fromA ? 1.0 : -1.0) * (field * vertexCount + vertex); };
+  const auto &localVertices = distribution.at(context.rank);
+
+  vector<vector<double>> sendFields(fieldCount), receiveFields(fieldCount, vector<double>(localVertices.size(), 0.0));
+  for (int field = 0; field < fieldCount; ++field) {
+    for (int vertex : localVertices) {
+      sendFields[field].push_back(value(context.isNamed("A"), field, vertex));
+    }
+    c.send(sendFields[field], 1);
+  }
+  for (int field = 0; field < fieldCount; ++field) {
+    c.receive(receiveFields[field], 1);
+  }
+  c.waitForSendRequests();
+
+  for (int field = 0; field < fieldCount; ++field) {
+    vector<double> expectedData;
+    for (int vertex : localVertices) {
+      expectedData.push_back(value(context.isNamed("B"), field, vertex));
+    }
+    BOOST_TEST(receiveFields[field] == expectedData, boost::test_tools::per_element());
   }
 }
 
@@ -515,6 +680,20 @@ BOOST_AUTO_TEST_CASE(P2PComTest2)
   runP2PComTest2(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(P2PComVectorTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComVectorTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PSendBeforeReceiveTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PSendBeforeReceiveTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(TestSameConnection)
 {
   PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
@@ -552,6 +731,45 @@ BOOST_AUTO_TEST_CASE(P2PComLocalCommunicationMapTest)
 
 BOOST_AUTO_TEST_SUITE_END() // Sockets
 
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(P2PComTest1)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PComTest1(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PComVectorTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PComVectorTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PSendBeforeReceiveTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PSendBeforeReceiveTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(TestCrossConnection)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runCrossConnectionTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyConnectionTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runEmptyConnectionTest(context, cf);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+
 BOOST_AUTO_TEST_SUITE(MPIPorts, *boost::unit_test::label("MPI_Ports"))
 
 BOOST_AUTO_TEST_CASE(P2PComTest1)
@@ -568,6 +786,27 @@ BOOST_AUTO_TEST_CASE(P2PComTest2)
   runP2PComTest2(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(P2PComVectorTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::MPIPortsCommunicationFactory);
+  runP2PComVectorTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PSendBeforeReceiveTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::MPIPortsCommunicationFactory);
+  runP2PSendBeforeReceiveTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PPersistentRequestsTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::MPIPortsCommunicationFactory);
+  runP2PPersistentRequestsTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(TestSameConnection)
 {
   PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
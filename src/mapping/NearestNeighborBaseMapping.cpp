@@ -65,19 +65,21 @@ void NearestNeighborBaseMapping::computeMapping()
   e2.stop();
 
   // Set up of output arrays
-  const size_t verticesSize   = origins->vertices().size();
-  const auto & sourceVertices = origins->vertices();
+  const size_t verticesSize = origins->vertices().size();
   _vertexIndices.resize(verticesSize);
 
   // Needed for error calculations
   utils::statistics::DistanceAccumulator distanceStatistics;
 
+  // Queries all vertices at once, which runs concurrently if multiple threads are configured
+  const auto matches = indexTree.getClosestVertices(origins->vertexCoordinates());
   for (size_t i = 0; i < verticesSize; ++i) {
-    const auto &matchedVertex = indexTree.getClosestVertex(sourceVertices[i].getCoords());
-    _vertexIndices[i]         = matchedVertex.index;
-    distanceStatistics(matchedVertex.distance);
+    _vertexIndices[i] = matches[i].index;
+    distanceStatistics(matches[i].distance);
   }
 
+  _operator.assemble(searchSpace->vertices().size(), _vertexIndices);
+
   // For gradient mapping, the calculation of offsets between source and matched vertex necessary
   onMappingComputed(origins, searchSpace);
 
@@ -102,15 +104,16 @@ void NearestNeighborBaseMapping::clear()
 {
   PRECICE_TRACE();
   _vertexIndices.clear();
+  _operator.clear();
   _hasComputedMapping = false;
 
   if (requireGradient())
-    _offsetsMatched.clear();
+    _offsetsMatched.resize(0, 0);
 
   if (getConstraint() == CONSISTENT) {
-    query::clearCache(input()->getID());
+    query::releaseCache(input()->getID());
   } else {
-    query::clearCache(output()->getID());
+    query::releaseCache(output()->getID());
   }
 }
 
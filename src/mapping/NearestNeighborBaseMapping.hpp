@@ -4,6 +4,7 @@
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/impl/SparseOperator.hpp"
 
 namespace precice {
 namespace mapping {
@@ -53,13 +54,15 @@ protected:
 
   mutable logging::Logger _log{"mapping::" + mappingName};
 
-  /// Compute the vector offset between the matched vector and the source vector (needed for gradient mapping)
-  /// Optimization: save this as an std::vector<double> and use an Eigen::Map to create an interface that uses the correct dimensions.
-  std::vector<Eigen::VectorXd> _offsetsMatched;
+  /// Compute the vector offset between the matched vector and the source vector (needed for gradient mapping), one offset per column
+  Eigen::MatrixXd _offsetsMatched;
 
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
 
+  /// The mapping compiled into a sparse matrix, see impl::SparseOperator
+  impl::SparseOperator _operator;
+
 private:
   /// Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping = false;
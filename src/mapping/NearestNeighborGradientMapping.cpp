@@ -32,20 +32,19 @@ NearestNeighborGradientMapping::NearestNeighborGradientMapping(
 void NearestNeighborGradientMapping::onMappingComputed(mesh::PtrMesh origins, mesh::PtrMesh searchSpace)
 {
 
-  // Initialize the offsets list
-  _offsetsMatched.resize(_vertexIndices.size());
+  const auto sourceCoords  = origins->vertexCoordinates();
+  const auto matchedCoords = searchSpace->vertexCoordinates();
+
+  // Initialize the offsets
+  _offsetsMatched.resize(sourceCoords.rows(), sourceCoords.cols());
 
   // Calculate offsets
   for (size_t i = 0; i < _vertexIndices.size(); ++i) {
-
-    const auto &matchedVertexCoords = searchSpace.get()->vertices()[_vertexIndices[i]].getCoords();
-    const auto &sourceVertexCoords  = origins->vertices()[i].getCoords();
-
     // We calculate the distances uniformly for both mapping constraints as the difference (input - output)
     if (hasConstraint(CONSERVATIVE)) {
-      _offsetsMatched[i] = sourceVertexCoords - matchedVertexCoords;
+      _offsetsMatched.col(i) = sourceCoords.col(i) - matchedCoords.col(_vertexIndices[i]);
     } else {
-      _offsetsMatched[i] = matchedVertexCoords - sourceVertexCoords;
+      _offsetsMatched.col(i) = matchedCoords.col(_vertexIndices[i]) - sourceCoords.col(i);
     }
   }
 };
@@ -79,10 +78,12 @@ void NearestNeighborGradientMapping::map(
   PRECICE_ASSERT(outputValues.size() / valueDimensions == static_cast<int>(output()->vertices().size()),
                  outputValues.size(), valueDimensions, output()->vertices().size());
 
+  // The values are mapped by the nearest-neighbor operator, the gradient terms are added separately
   if (hasConstraint(CONSERVATIVE)) {
     PRECICE_DEBUG("Map conservative");
-    size_t const inSize = input()->vertices().size();
+    _operator.applyTransposed(inputValues, outputValues, valueDimensions);
 
+    size_t const inSize = input()->vertices().size();
     for (size_t i = 0; i < inSize; i++) {
       int const outputIndex = _vertexIndices[i] * valueDimensions;
 
@@ -91,13 +92,15 @@ void NearestNeighborGradientMapping::map(
         const int mapOutputIndex = outputIndex + dim;
         const int mapInputIndex  = (i * valueDimensions) + dim;
 
-        outputValues(mapOutputIndex) += inputValues(mapInputIndex) + _offsetsMatched[i].transpose() * gradientValues.col(mapInputIndex);
+        outputValues(mapOutputIndex) += _offsetsMatched.col(i).dot(gradientValues.col(mapInputIndex));
       }
     }
   } else {
     PRECICE_DEBUG((hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent"));
-    size_t const outSize = output()->vertices().size();
+    outputValues.setZero();
+    _operator.apply(inputValues, outputValues, valueDimensions);
 
+    size_t const outSize = output()->vertices().size();
     for (size_t i = 0; i < outSize; i++) {
       int inputIndex = _vertexIndices[i] * valueDimensions;
 
@@ -106,7 +109,7 @@ void NearestNeighborGradientMapping::map(
         const int mapOutputIndex = (i * valueDimensions) + dim;
         const int mapInputIndex  = inputIndex + dim;
 
-        outputValues(mapOutputIndex) = inputValues(mapInputIndex) + _offsetsMatched[i].transpose() * gradientValues.col(mapInputIndex);
+        outputValues(mapOutputIndex) += _offsetsMatched.col(i).dot(gradientValues.col(mapInputIndex));
       }
     }
     if (hasConstraint(SCALEDCONSISTENT)) {
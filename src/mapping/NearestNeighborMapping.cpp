@@ -47,34 +47,11 @@ void NearestNeighborMapping::map(
 
   if (hasConstraint(CONSERVATIVE)) {
     PRECICE_DEBUG("Map conservative");
-    size_t const inSize = input()->vertices().size();
-
-    for (size_t i = 0; i < inSize; i++) {
-      int const outputIndex = _vertexIndices[i] * valueDimensions;
-
-      for (int dim = 0; dim < valueDimensions; dim++) {
-
-        const int mapOutputIndex = outputIndex + dim;
-        const int mapInputIndex  = (i * valueDimensions) + dim;
-
-        outputValues(mapOutputIndex) += inputValues(mapInputIndex);
-      }
-    }
+    _operator.applyTransposed(inputValues, outputValues, valueDimensions);
   } else {
     PRECICE_DEBUG((hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent"));
-    size_t const outSize = output()->vertices().size();
-
-    for (size_t i = 0; i < outSize; i++) {
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-
-      for (int dim = 0; dim < valueDimensions; dim++) {
-
-        const int mapOutputIndex = (i * valueDimensions) + dim;
-        const int mapInputIndex  = inputIndex + dim;
-
-        outputValues(mapOutputIndex) = inputValues(mapInputIndex);
-      }
-    }
+    outputValues.setZero();
+    _operator.apply(inputValues, outputValues, valueDimensions);
     if (hasConstraint(SCALEDCONSISTENT)) {
       scaleConsistentMapping(inputDataID, outputDataID);
     }
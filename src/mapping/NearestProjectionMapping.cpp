@@ -102,16 +102,21 @@ void NearestProjectionMapping::computeMapping()
   query::Index                           indexTree(searchSpace);
   utils::statistics::DistanceAccumulator distanceStatistics;
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
-
-  for (const auto &fVertex : fVertices) {
-    // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
-    // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
-    auto match = indexTree.findNearestProjection(fVertex.getCoords(), nnearest);
-    _interpolations.push_back(std::move(match.polation));
-    distanceStatistics(match.distance);
+  // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
+  // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
+  // All vertices are queried at once, which runs concurrently if multiple threads are configured
+  const auto matches = indexTree.findNearestProjections(origins->vertexCoordinates(), nnearest);
+
+  // The weights of all interpolations form the rows of the mapping operator
+  std::vector<impl::SparseOperator::Triplet> entries;
+  entries.reserve(matches.size() * getDimensions());
+  for (std::size_t i = 0; i < matches.size(); ++i) {
+    for (const auto &elem : matches[i].polation.getWeightedElements()) {
+      entries.emplace_back(i, elem.vertexID, elem.weight);
+    }
+    distanceStatistics(matches[i].distance);
   }
+  _operator.assemble(matches.size(), searchSpace->vertices().size(), entries);
 
   if (distanceStatistics.empty()) {
     PRECICE_INFO("Mapping distance not available due to empty partition.");
@@ -130,7 +135,7 @@ bool NearestProjectionMapping::hasComputedMapping() const
 void NearestProjectionMapping::clear()
 {
   PRECICE_TRACE();
-  _interpolations.clear();
+  _operator.clear();
   _hasComputedMapping = false;
 }
 
@@ -153,36 +158,14 @@ void NearestProjectionMapping::map(
   if (hasConstraint(CONSERVATIVE)) {
     PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
     PRECICE_DEBUG("Map conservative");
-    PRECICE_ASSERT(_interpolations.size() == input()->vertices().size(),
-                   _interpolations.size(), input()->vertices().size());
-    for (size_t i = 0; i < input()->vertices().size(); i++) {
-      size_t      inOffset = i * dimensions;
-      const auto &elems    = _interpolations[i].getWeightedElements();
-      for (const auto &elem : elems) {
-        size_t outOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    PRECICE_ASSERT(_operator.matrix().rows() == static_cast<Eigen::Index>(input()->vertices().size()),
+                   _operator.matrix().rows(), input()->vertices().size());
+    _operator.applyTransposed(inValues, outValues, dimensions);
   } else {
     PRECICE_DEBUG("Map consistent");
-    PRECICE_ASSERT(_interpolations.size() == output()->vertices().size(),
-                   _interpolations.size(), output()->vertices().size());
-    for (size_t i = 0; i < output()->vertices().size(); i++) {
-      const auto &elems     = _interpolations[i].getWeightedElements();
-      size_t      outOffset = i * dimensions;
-      for (const auto &elem : elems) {
-        size_t inOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    PRECICE_ASSERT(_operator.matrix().rows() == static_cast<Eigen::Index>(output()->vertices().size()),
+                   _operator.matrix().rows(), output()->vertices().size());
+    _operator.apply(inValues, outValues, dimensions);
     if (hasConstraint(SCALEDCONSISTENT)) {
       scaleConsistentMapping(inputDataID, outputDataID);
     }
@@ -211,10 +194,11 @@ void NearestProjectionMapping::tagMeshFirstRound()
   std::unordered_set<int> tagged;
   const std::size_t       max_count = origins->vertices().size();
 
-  for (const Polation &interpolation : _interpolations) {
-    for (const auto &elem : interpolation.getWeightedElements()) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.vertexID);
+  const auto &matrix = _operator.matrix();
+  for (Eigen::Index row = 0; row < matrix.outerSize(); ++row) {
+    for (impl::SparseOperator::Matrix::InnerIterator it(matrix, row); it; ++it) {
+      if (!math::equals(it.value(), 0.0)) {
+        tagged.insert(it.col());
       }
     }
     // Shortcut if all vertices are tagged
@@ -6,6 +6,7 @@
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/Polation.hpp"
+#include "mapping/impl/SparseOperator.hpp"
 
 namespace precice {
 namespace mapping {
@@ -49,7 +50,8 @@ public:
 private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
-  std::vector<Polation> _interpolations;
+  /// The interpolation weights of all projections, one row per origin vertex
+  impl::SparseOperator _operator;
 
   bool _hasComputedMapping = false;
 };
@@ -0,0 +1,398 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <algorithm>
+#include <vector>
+
+#include "impl/BasisFunctions.hpp"
+#include "logging/LogMacros.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/impl/PartitionOfUnity.hpp"
+#include "mapping/impl/SparseOperator.hpp"
+#include "mesh/BoundingBox.hpp"
+#include "mesh/Mesh.hpp"
+#include "query/Index.hpp"
+#include "utils/Event.hpp"
+#include "utils/Threading.hpp"
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Mapping with radial basis functions localized by a partition of unity.
+ *
+ * The input mesh is covered by overlapping spherical clusters. Within each cluster, a local
+ * interpolant is formed by the given radial basis function and a linear polynomial.
+ * The local interpolants are blended using smooth weights, which sum up to one at every output vertex.
+ *
+ * In contrast to the global RadialBasisFctMapping, only small dense systems have to be solved.
+ * These are independent of each other and are solved concurrently using utils::Threading.
+ * The blended interpolants are compiled into a single sparse operator.
+ * The mapping operates on the local partitions of the meshes and requires no global communication.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class PartitionOfUnityMapping : public Mapping {
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for the local interpolants.
+   * @param[in] verticesPerCluster Targeted number of input vertices per cluster
+   * @param[in] relativeOverlap Overlap of the clusters relative to their distance
+   */
+  PartitionOfUnityMapping(
+      Constraint              constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      int                     verticesPerCluster,
+      double                  relativeOverlap);
+
+  /// Computes the local interpolants of all clusters.
+  void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  void map(int inputDataID, int outputDataID) override;
+
+  /// Tags all vertices of the remote mesh, which are part of a cluster containing local vertices.
+  void tagMeshFirstRound() override;
+
+  /// No operation needed, as the first round already tags all required vertices.
+  void tagMeshSecondRound() override;
+
+private:
+  precice::logging::Logger _log{"mapping::PartitionOfUnityMapping"};
+
+  /// A cluster and its local interpolant
+  struct Cluster {
+    Eigen::VectorXd center;
+
+    /// Indices of the vertices to interpolate from
+    std::vector<int> inputIDs;
+
+    /// Indices of the vertices to evaluate the interpolant at
+    std::vector<int> outputIDs;
+
+    /// Partition-of-unity weights of the output vertices
+    Eigen::VectorXd weights;
+
+    /// Maps the values at the input vertices to the weighted values at the output vertices
+    Eigen::MatrixXd interpolant;
+  };
+
+  bool _hasComputedMapping = false;
+
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  int _verticesPerCluster;
+
+  double _relativeOverlap;
+
+  /// The blended local interpolants, one row per output vertex
+  impl::SparseOperator _operator;
+
+  /**
+   * @brief Covers the input mesh by clusters and assigns the vertices of both meshes to them.
+   *
+   * Only clusters containing output vertices are kept.
+   * Output vertices outside of all clusters are assigned to the cluster with the closest center.
+   */
+  std::vector<Cluster> createClusters(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh) const;
+
+  /// Solves the local interpolation system of the cluster and stores the resulting interpolant
+  void computeInterpolant(Cluster &cluster, const Eigen::MatrixXd &inCoords, const Eigen::MatrixXd &outCoords) const;
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    int                     verticesPerCluster,
+    double                  relativeOverlap)
+    : Mapping(constraint, dimensions),
+      _basisFunction(function),
+      _verticesPerCluster(verticesPerCluster),
+      _relativeOverlap(relativeOverlap)
+{
+  PRECICE_CHECK(verticesPerCluster > 0,
+                "The number of vertices per cluster of a partition-of-unity mapping has to be positive, but is {}.", verticesPerCluster);
+  PRECICE_CHECK(relativeOverlap >= 0,
+                "The relative overlap of a partition-of-unity mapping must not be negative, but is {}.", relativeOverlap);
+  if (constraint == SCALEDCONSISTENT) {
+    setInputRequirement(Mapping::MeshRequirement::FULL);
+    setOutputRequirement(Mapping::MeshRequirement::FULL);
+  } else {
+    setInputRequirement(Mapping::MeshRequirement::VERTEX);
+    setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.pum.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
+                 input()->getDimensions(), output()->getDimensions());
+  PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
+                 getDimensions(), output()->getDimensions());
+
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  if (hasConstraint(CONSERVATIVE)) {
+    inMesh  = output();
+    outMesh = input();
+  } else {
+    inMesh  = input();
+    outMesh = output();
+  }
+
+  std::vector<Cluster> clusters = createClusters(inMesh, outMesh);
+
+  const Eigen::MatrixXd inCoords  = inMesh->vertexCoordinates();
+  const Eigen::MatrixXd outCoords = outMesh->vertexCoordinates();
+  utils::Threading::parallelFor(clusters.size(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      computeInterpolant(clusters[i], inCoords, outCoords);
+    }
+  });
+
+  // The contributions of overlapping clusters to an output vertex are summed up
+  std::vector<impl::SparseOperator::Triplet> entries;
+  for (const Cluster &cluster : clusters) {
+    for (std::size_t i = 0; i < cluster.outputIDs.size(); ++i) {
+      for (std::size_t j = 0; j < cluster.inputIDs.size(); ++j) {
+        entries.emplace_back(cluster.outputIDs[i], cluster.inputIDs[j], cluster.interpolant(i, j));
+      }
+    }
+  }
+  _operator.assemble(outCoords.cols(), inCoords.cols(), entries);
+
+  PRECICE_DEBUG("Computed {} local interpolants for {} input vertices", clusters.size(), inMesh->vertices().size());
+  _hasComputedMapping = true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  PRECICE_TRACE();
+  _operator.clear();
+  _hasComputedMapping = false;
+  query::releaseCache(input()->getID());
+  query::releaseCache(output()->getID());
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int outputDataID)
+{
+  PRECICE_TRACE(inputDataID, outputDataID);
+  precice::utils::Event e("map.pum.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(_hasComputedMapping);
+  const int valueDim = input()->data(inputDataID)->getDimensions();
+  PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
+                 valueDim, output()->data(outputDataID)->getDimensions());
+
+  const Eigen::VectorXd &inputValues  = input()->data(inputDataID)->values();
+  Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
+  PRECICE_ASSERT(inputValues.size() == valueDim * static_cast<Eigen::Index>(input()->vertices().size()),
+                 inputValues.size(), valueDim, input()->vertices().size());
+  PRECICE_ASSERT(outputValues.size() == valueDim * static_cast<Eigen::Index>(output()->vertices().size()),
+                 outputValues.size(), valueDim, output()->vertices().size());
+
+  outputValues.setZero();
+  if (hasConstraint(CONSERVATIVE)) {
+    PRECICE_DEBUG("Map conservative");
+    // The interpolants map from the output to the input mesh and are applied transposed
+    _operator.applyTransposed(inputValues, outputValues, valueDim);
+  } else {
+    PRECICE_DEBUG((hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent"));
+    _operator.apply(inputValues, outputValues, valueDim);
+    if (hasConstraint(SCALEDCONSISTENT)) {
+      scaleConsistentMapping(inputDataID, outputDataID);
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  PRECICE_TRACE();
+  mesh::PtrMesh filterMesh, otherMesh;
+  if (hasConstraint(CONSERVATIVE)) {
+    filterMesh = output(); // remote
+    otherMesh  = input();  // local
+  } else {
+    filterMesh = input();  // remote
+    otherMesh  = output(); // local
+  }
+
+  if (otherMesh->vertices().empty())
+    return; // Ranks not at the interface should never hold interface vertices
+
+  for (const Cluster &cluster : createClusters(filterMesh, otherMesh)) {
+    for (int id : cluster.inputIDs) {
+      filterMesh->vertices()[id].tag();
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  PRECICE_TRACE();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<typename PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::Cluster>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::createClusters(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh) const
+{
+  std::vector<Cluster> clusters;
+  if (inMesh->vertices().empty() || outMesh->vertices().empty()) {
+    return clusters;
+  }
+
+  const Eigen::MatrixXd inCoords  = inMesh->vertexCoordinates();
+  const Eigen::MatrixXd outCoords = outMesh->vertexCoordinates();
+
+  // Covers both meshes, such that output vertices outside of the input mesh are contained in clusters as well
+  const Eigen::VectorXd     lower   = inCoords.rowwise().minCoeff().cwiseMin(outCoords.rowwise().minCoeff());
+  const Eigen::VectorXd     upper   = inCoords.rowwise().maxCoeff().cwiseMax(outCoords.rowwise().maxCoeff());
+  const double              spacing = impl::estimateClusterSpacing(inCoords, _verticesPerCluster);
+  const impl::ClusterLayout layout  = impl::createClusterLayout(lower, upper, spacing, _relativeOverlap);
+  const double              radius  = layout.radius;
+  const Eigen::MatrixXd &   centers = layout.centers;
+
+  query::Index inIndex(inMesh);
+  query::Index outIndex(outMesh);
+
+  // Returns the vertices of the mesh within the radius around the center
+  auto verticesInside = [radius](query::Index &index, const Eigen::MatrixXd &coords, const Eigen::VectorXd &center) {
+    std::vector<double> bounds;
+    for (int d = 0; d < center.size(); ++d) {
+      bounds.push_back(center[d] - radius);
+      bounds.push_back(center[d] + radius);
+    }
+    std::vector<int> ids;
+    for (auto id : index.getVerticesInsideBox(mesh::BoundingBox(bounds))) {
+      if ((coords.col(id) - center).norm() < radius) {
+        ids.push_back(id);
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  };
+
+  for (Eigen::Index i = 0; i < centers.cols(); ++i) {
+    Cluster cluster;
+    cluster.center    = centers.col(i);
+    cluster.outputIDs = verticesInside(outIndex, outCoords, cluster.center);
+    if (cluster.outputIDs.empty()) {
+      continue;
+    }
+    cluster.inputIDs = verticesInside(inIndex, inCoords, cluster.center);
+    if (cluster.inputIDs.empty()) {
+      continue;
+    }
+    cluster.weights.resize(cluster.outputIDs.size());
+    for (std::size_t j = 0; j < cluster.outputIDs.size(); ++j) {
+      cluster.weights[j] = impl::evaluateClusterWeight((outCoords.col(cluster.outputIDs[j]) - cluster.center).norm(), radius);
+    }
+    clusters.push_back(std::move(cluster));
+  }
+  PRECICE_ASSERT(not clusters.empty());
+
+  Eigen::VectorXd weightSums = Eigen::VectorXd::Zero(outCoords.cols());
+  for (const Cluster &cluster : clusters) {
+    for (std::size_t j = 0; j < cluster.outputIDs.size(); ++j) {
+      weightSums[cluster.outputIDs[j]] += cluster.weights[j];
+    }
+  }
+
+  // Output vertices outside of all clusters with input vertices are extrapolated by the closest cluster
+  for (Eigen::Index id = 0; id < outCoords.cols(); ++id) {
+    if (weightSums[id] > 0.0) {
+      continue;
+    }
+    auto closest = std::min_element(clusters.begin(), clusters.end(), [&](const Cluster &lhs, const Cluster &rhs) {
+      return (lhs.center - outCoords.col(id)).squaredNorm() < (rhs.center - outCoords.col(id)).squaredNorm();
+    });
+    closest->outputIDs.push_back(id);
+    closest->weights.conservativeResize(closest->weights.size() + 1);
+    closest->weights.tail(1).setOnes();
+    weightSums[id] = 1.0;
+  }
+
+  // Normalizes the weights to form a partition of unity
+  for (Cluster &cluster : clusters) {
+    for (std::size_t j = 0; j < cluster.outputIDs.size(); ++j) {
+      cluster.weights[j] /= weightSums[cluster.outputIDs[j]];
+    }
+  }
+  return clusters;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeInterpolant(
+    Cluster &cluster, const Eigen::MatrixXd &inCoords, const Eigen::MatrixXd &outCoords) const
+{
+  const int  dimensions = inCoords.rows();
+  const auto n          = static_cast<Eigen::Index>(cluster.inputIDs.size());
+  const auto m          = static_cast<Eigen::Index>(cluster.outputIDs.size());
+  const int  polyparams = 1 + dimensions;
+
+  // Interpolation system including a linear polynomial, coordinates are relative to the center for a better conditioning
+  Eigen::MatrixXd matrixCLU = Eigen::MatrixXd::Zero(n + polyparams, n + polyparams);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    const Eigen::VectorXd x = inCoords.col(cluster.inputIDs[i]);
+    for (Eigen::Index j = 0; j < i; ++j) {
+      matrixCLU(i, j) = _basisFunction.evaluate((x - inCoords.col(cluster.inputIDs[j])).norm());
+      matrixCLU(j, i) = matrixCLU(i, j);
+    }
+    matrixCLU(i, i) = _basisFunction.evaluate(0.0);
+
+    matrixCLU(i, n)                          = 1.0;
+    matrixCLU(n, i)                          = 1.0;
+    matrixCLU.block(i, n + 1, 1, dimensions) = (x - cluster.center).transpose();
+    matrixCLU.block(n + 1, i, dimensions, 1) = x - cluster.center;
+  }
+
+  Eigen::MatrixXd matrixA(m, n + polyparams);
+  for (Eigen::Index i = 0; i < m; ++i) {
+    const Eigen::VectorXd y = outCoords.col(cluster.outputIDs[i]);
+    for (Eigen::Index j = 0; j < n; ++j) {
+      matrixA(i, j) = _basisFunction.evaluate((y - inCoords.col(cluster.inputIDs[j])).norm());
+    }
+    matrixA(i, n)                          = 1.0;
+    matrixA.block(i, n + 1, 1, dimensions) = (y - cluster.center).transpose();
+  }
+
+  // The polynomial is rank deficient for clusters of degenerated geometry, which the column pivoting handles
+  Eigen::MatrixXd identity = Eigen::MatrixXd::Zero(n + polyparams, n);
+  identity.topRows(n)      = Eigen::MatrixXd::Identity(n, n);
+  cluster.interpolant      = cluster.weights.asDiagonal() * (matrixA * matrixCLU.colPivHouseholderQr().solve(identity));
+}
+
+} // namespace mapping
+} // namespace precice
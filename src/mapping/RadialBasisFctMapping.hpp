@@ -1,12 +1,19 @@
 #pragma once
 
+#include <Eigen/Cholesky>
 #include <Eigen/Core>
 #include <Eigen/QR>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <algorithm>
+#include <vector>
 
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
 #include "impl/BasisFunctions.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/impl/SchurRBFSolver.hpp"
+#include "mesh/BoundingBox.hpp"
 #include "mesh/Filter.hpp"
 #include "precice/types.hpp"
 #include "query/Index.hpp"
@@ -19,6 +26,11 @@ extern bool syncMode;
 
 namespace mapping {
 
+inline Eigen::MatrixXd buildMatrixP(const mesh::Mesh &inputMesh, std::vector<bool> deadAxis);
+
+/// Fraction of non-zero entries of the kernel matrix up to which the sparse decomposition is used
+constexpr double maxSparseFill = 0.1;
+
 /**
  * @brief Mapping with radial basis functions.
  *
@@ -29,6 +41,13 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * The interpolation system is solved depending on the traits of the basis function:
+ * - For basis functions with compact support and an estimated fill of the kernel matrix of at most maxSparseFill,
+ *   the interpolation and evaluation matrices are assembled as sparse matrices and the kernel matrix is
+ *   factorized with a sparse LDLT decomposition.
+ * - For strictly positive definite basis functions, the kernel matrix is factorized with a dense LLT decomposition.
+ * - Otherwise, or if the above decompositions fail, the whole interpolation matrix is factorized with a QR decomposition.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping {
@@ -73,16 +92,55 @@ private:
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
+  /// The decomposition used to solve the interpolation system
+  enum class Solver {
+    QR,
+    Cholesky,
+    Sparse
+  };
+
+  Solver _solver = Solver::QR;
+
   Eigen::MatrixXd _matrixA;
 
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
 
+  /// Solver of the interpolation system for strictly positive definite basis functions
+  impl::SchurRBFSolver<Eigen::LLT<Eigen::MatrixXd>> _cholesky;
+
+  /// Evaluation matrix, used instead of _matrixA for basis functions with compact support
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _sparseMatrixA;
+
+  /// Solver of the interpolation system for basis functions with compact support
+  impl::SchurRBFSolver<Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>> _sparseSolver;
+
   /// true if the mapping along some axis should be ignored
   std::vector<bool> _deadAxis;
 
   void mapConservative(int inputDataID, int outputDataID, int polyparams);
   void mapConsistent(int inputDataID, int outputDataID, int polyparams);
 
+  /// Assembles and factorizes the sparse matrices, returns false if the factorization failed
+  bool computeSparseMapping(mesh::Mesh &globalInMesh, const mesh::Mesh &globalOutMesh);
+
+  /// Factorizes the kernel matrix with a Cholesky decomposition, returns false if the factorization failed
+  bool computeCholesky(const Eigen::MatrixXd &matrixCLU, int polyparams);
+
+  /// Returns the number of rows of the evaluation matrix, which equals the size of the output mesh
+  Eigen::Index evaluationRows() const;
+
+  /// Returns the number of columns of the evaluation matrix, which equals the size of the interpolation system
+  Eigen::Index evaluationCols() const;
+
+  /// Solves the interpolation system for the given right-hand sides, one per column
+  Eigen::MatrixXd solveSystem(const Eigen::MatrixXd &rhs) const;
+
+  /// Applies the evaluation matrix to the given coefficients, one set per column
+  Eigen::MatrixXd evaluate(const Eigen::MatrixXd &coefficients) const;
+
+  /// Applies the transposed evaluation matrix to the given values, one set per column
+  Eigen::MatrixXd evaluateTransposed(const Eigen::MatrixXd &values) const;
+
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
     _deadAxis.resize(getDimensions());
@@ -189,20 +247,121 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
       globalOutMesh.addMesh(*outMesh);
     }
 
-    _matrixA = buildMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
-    _qr      = buildMatrixCLU(_basisFunction, globalInMesh, _deadAxis).colPivHouseholderQr();
+    if (_basisFunction.hasCompactSupport() && computeSparseMapping(globalInMesh, globalOutMesh)) {
+      _solver = Solver::Sparse;
+    } else {
+      _matrixA = buildMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
+
+      const Eigen::MatrixXd matrixCLU  = buildMatrixCLU(_basisFunction, globalInMesh, _deadAxis);
+      const int             polyparams = matrixCLU.rows() - globalInMesh.vertices().size();
+      if (_basisFunction.isStrictlyPositiveDefinite() && computeCholesky(matrixCLU, polyparams)) {
+        _solver = Solver::Cholesky;
+      } else {
+        _solver = Solver::QR;
+        _qr     = matrixCLU.colPivHouseholderQr();
+      }
 
-    PRECICE_CHECK(_qr.isInvertible(),
-                  "The interpolation matrix of the RBF mapping from mesh {} to mesh {} is not invertable. "
-                  "This means that the mapping problem is not well-posed. "
-                  "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
-                  "by marking perpendicular axes as dead?",
-                  input()->getName(), output()->getName());
+      PRECICE_CHECK(_solver != Solver::QR || _qr.isInvertible(),
+                    "The interpolation matrix of the RBF mapping from mesh {} to mesh {} is not invertable. "
+                    "This means that the mapping problem is not well-posed. "
+                    "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
+                    "by marking perpendicular axes as dead?",
+                    input()->getName(), output()->getName());
+    }
   }
   _hasComputedMapping = true;
   PRECICE_DEBUG("Compute Mapping is Completed.");
 } // namespace mapping
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeSparseMapping(mesh::Mesh &globalInMesh, const mesh::Mesh &globalOutMesh)
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.rbf.computeSparseMapping.From" + input()->getName() + "To" + output()->getName());
+
+  // The global mesh has no unique ID, hence a cached index of another mesh has to be dropped.
+  query::clearCache(globalInMesh);
+  {
+    // The index requires a shared pointer, but globalInMesh outlives it
+    query::Index inIndex(mesh::PtrMesh(&globalInMesh, [](mesh::Mesh *) {}));
+
+    // A large support, e.g. of a Gaussian, yields a nearly dense kernel matrix, which the dense decompositions handle faster
+    const double fill = estimateKernelFill(_basisFunction, globalInMesh, inIndex, _deadAxis);
+    if (fill > maxSparseFill) {
+      PRECICE_DEBUG("Estimated fill of {} of the kernel matrix is too large for the sparse factorization.", fill);
+      query::clearCache(globalInMesh);
+      return false;
+    }
+
+    _sparseMatrixA                         = buildSparseMatrixA(_basisFunction, globalInMesh, inIndex, globalOutMesh, _deadAxis);
+    const Eigen::SparseMatrix<double> matrixC = buildSparseMatrixC(_basisFunction, globalInMesh, inIndex, _deadAxis);
+    if (not _sparseSolver.compute(matrixC, buildMatrixP(globalInMesh, _deadAxis))) {
+      PRECICE_DEBUG("The sparse factorization failed, falling back to a dense decomposition.");
+      _sparseMatrixA = Eigen::SparseMatrix<double, Eigen::RowMajor>();
+    } else {
+      PRECICE_DEBUG("Sparse RBF system of size {} with {} non-zeros in the kernel matrix and {} non-zeros in the evaluation matrix",
+                    _sparseSolver.size(), matrixC.nonZeros(), _sparseMatrixA.nonZeros());
+    }
+  }
+  query::clearCache(globalInMesh);
+  return _sparseSolver.size() > 0;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeCholesky(const Eigen::MatrixXd &matrixCLU, int polyparams)
+{
+  PRECICE_TRACE(polyparams);
+  const Eigen::Index n = matrixCLU.rows() - polyparams;
+  if (not _cholesky.compute(matrixCLU.topLeftCorner(n, n), matrixCLU.topRightCorner(n, polyparams))) {
+    PRECICE_DEBUG("The Cholesky decomposition failed, falling back to the QR decomposition.");
+    return false;
+  }
+  return true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluationRows() const
+{
+  return _solver == Solver::Sparse ? _sparseMatrixA.rows() : _matrixA.rows();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluationCols() const
+{
+  return _solver == Solver::Sparse ? _sparseMatrixA.cols() : _matrixA.cols();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solveSystem(const Eigen::MatrixXd &rhs) const
+{
+  switch (_solver) {
+  case Solver::Sparse:
+    return _sparseSolver.solve(rhs);
+  case Solver::Cholesky:
+    return _cholesky.solve(rhs);
+  default:
+    return _qr.solve(rhs);
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluate(const Eigen::MatrixXd &coefficients) const
+{
+  if (_solver == Solver::Sparse) {
+    return _sparseMatrixA * coefficients;
+  }
+  return _matrixA * coefficients;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateTransposed(const Eigen::MatrixXd &values) const
+{
+  if (_solver == Solver::Sparse) {
+    return _sparseMatrixA.transpose() * values;
+  }
+  return _matrixA.transpose() * values;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 bool RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
 {
@@ -215,6 +374,10 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
   PRECICE_TRACE();
   _matrixA            = Eigen::MatrixXd();
   _qr                 = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _sparseMatrixA      = Eigen::SparseMatrix<double, Eigen::RowMajor>();
+  _cholesky.clear();
+  _sparseSolver.clear();
+  _solver             = Solver::QR;
   _hasComputedMapping = false;
 }
 
@@ -308,28 +471,16 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(int inputDa
 
     int valueDim = output()->data(outputDataID)->getDimensions();
 
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
-    Eigen::VectorXd             outputValues((_matrixA.cols() - polyparams) * valueDim);
-    outputValues.setZero();
-
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
+    // The values are stored interleaved per vertex, hence each column of the transposed map holds one data dimension
+    Eigen::Map<const Eigen::MatrixXd> inputValues(globalInValues.data(), valueDim, evaluationRows()); // cols == outputSize
 
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inputValues(i * valueDim + dim);
-      }
+    // Perform the mapping for all data dimensions at once
+    const Eigen::MatrixXd Au  = evaluateTransposed(inputValues.transpose()); // rows == n
+    const Eigen::MatrixXd out = solveSystem(Au);                             // rows == n
 
-      Au  = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
-
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size() - polyparams; i++) {
-        outputValues[i * valueDim + dim] = out[i];
-      }
-    }
+    // Copy mapped data to output data values, interleaved per vertex
+    const Eigen::MatrixXd             outTransposed = out.topRows(out.rows() - polyparams).transpose();
+    Eigen::Map<const Eigen::VectorXd> outputValues(outTransposed.data(), outTransposed.size());
 
     // Data scattering to slaves
     if (utils::MasterSlave::isMaster()) {
@@ -394,7 +545,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(int inputData
 
     int valueDim = output()->data(outputDataID)->getDimensions();
 
-    std::vector<double> globalInValues((_matrixA.cols() - polyparams) * valueDim, 0.0);
+    std::vector<double> globalInValues((evaluationCols() - polyparams) * valueDim, 0.0);
     std::vector<int>    outValuesSize;
 
     if (utils::MasterSlave::isMaster()) { // Parallel case
@@ -424,32 +575,19 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(int inputData
       outValuesSize.push_back(output()->data(outputDataID)->values().size());
     }
 
-    Eigen::VectorXd p(_matrixA.cols());   // rows == n
-    Eigen::VectorXd in(_matrixA.cols());  // rows == n
-    Eigen::VectorXd out(_matrixA.rows()); // rows == outputSize
-    in.setZero();
-
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
-
-    Eigen::VectorXd outputValues((_matrixA.rows()) * valueDim);
-    outputValues.setZero();
+    // The values are stored interleaved per vertex, hence each column of the transposed map holds one data dimension
+    Eigen::Map<const Eigen::MatrixXd> inputValues(globalInValues.data(), valueDim, evaluationCols() - polyparams);
 
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
-      // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < in.size() - polyparams; i++) {
-        in[i] = inputValues[i * valueDim + dim];
-      }
+    // Fill input from input data values (last polyparams entries remain zero)
+    Eigen::MatrixXd in = Eigen::MatrixXd::Zero(evaluationCols(), valueDim); // rows == n
+    in.topRows(inputValues.cols()) = inputValues.transpose();
 
-      p   = _qr.solve(in);
-      out = _matrixA * p;
+    // Perform the mapping for all data dimensions at once
+    const Eigen::MatrixXd p   = solveSystem(in); // rows == n
+    const Eigen::MatrixXd out = evaluate(p);     // rows == outputSize
 
-      // Copy mapped data to ouptut data values
-      for (int i = 0; i < out.size(); i++) {
-        outputValues[i * valueDim + dim] = out[i];
-      }
-    }
+    // Copy mapped data to ouptut data values, interleaved per vertex
+    Eigen::MatrixXd outputValues = out.transpose();
 
     output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
 
@@ -538,6 +676,55 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
 
 // ------- Non-Member Functions ---------
 
+/// Returns the coordinates of all vertices of the mesh along the non-dead axes, one vertex per column
+inline Eigen::MatrixXd reducedVertexCoordinates(const mesh::Mesh &mesh, const std::vector<bool> &deadAxis)
+{
+  const auto coords = mesh.vertexCoordinates();
+  const int  liveDimensions =
+      mesh.getDimensions() - static_cast<int>(std::count(deadAxis.begin(), deadAxis.end(), true));
+
+  Eigen::MatrixXd reduced(liveDimensions, coords.cols());
+  for (int d = 0, row = 0; d < mesh.getDimensions(); ++d) {
+    if (not deadAxis[d]) {
+      reduced.row(row++) = coords.row(d);
+    }
+  }
+  return reduced;
+}
+
+/**
+ * @brief Search box around a location, which contains all input vertices within the support radius.
+ *
+ * Distances are measured along the live axes only, hence the box spans the whole input mesh along dead axes.
+ */
+class SupportBox {
+public:
+  SupportBox(const mesh::Mesh &inputMesh, const std::vector<bool> &deadAxis, double supportRadius)
+      : _deadAxis(deadAxis),
+        _supportRadius(supportRadius)
+  {
+    const auto coords = inputMesh.vertexCoordinates();
+    _meshMin          = coords.rowwise().minCoeff();
+    _meshMax          = coords.rowwise().maxCoeff();
+  }
+
+  mesh::BoundingBox around(const Eigen::Ref<const Eigen::VectorXd> &location) const
+  {
+    std::vector<double> bounds(2 * location.size());
+    for (int d = 0; d < location.size(); ++d) {
+      bounds[2 * d]     = _deadAxis[d] ? _meshMin[d] : location[d] - _supportRadius;
+      bounds[2 * d + 1] = _deadAxis[d] ? _meshMax[d] : location[d] + _supportRadius;
+    }
+    return mesh::BoundingBox(std::move(bounds));
+  }
+
+private:
+  std::vector<bool> _deadAxis;
+  double            _supportRadius;
+  Eigen::VectorXd   _meshMin;
+  Eigen::VectorXd   _meshMax;
+};
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, std::vector<bool> deadAxis)
 {
@@ -557,17 +744,15 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
 
+  const Eigen::MatrixXd inputCoords = reducedVertexCoordinates(inputMesh, deadAxis);
+
   for (int i = 0; i < inputSize; ++i) {
     for (int j = i; j < inputSize; ++j) {
-      const auto &u   = inputMesh.vertices()[i].getCoords();
-      const auto &v   = inputMesh.vertices()[j].getCoords();
-      matrixCLU(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+      matrixCLU(i, j) = basisFunction.evaluate((inputCoords.col(i) - inputCoords.col(j)).norm());
     }
 
-    const auto reduced = utils::reduceVector(inputMesh.vertices()[i].getCoords(), deadAxis);
-
     for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixCLU(i, inputSize + 1 + dim) = reduced[dim];
+      matrixCLU(i, inputSize + 1 + dim) = inputCoords(dim, i);
     }
     matrixCLU(i, inputSize) = 1.0;
   }
@@ -597,23 +782,128 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
   Eigen::MatrixXd matrixA(outputSize, n);
   matrixA.setZero();
 
+  const Eigen::MatrixXd inputCoords  = reducedVertexCoordinates(inputMesh, deadAxis);
+  const Eigen::MatrixXd outputCoords = reducedVertexCoordinates(outputMesh, deadAxis);
+
   // Fill _matrixA with values
   for (int i = 0; i < outputSize; ++i) {
     for (int j = 0; j < inputSize; ++j) {
-      const auto &u = outputMesh.vertices()[i].getCoords();
-      const auto &v = inputMesh.vertices()[j].getCoords();
-      matrixA(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+      matrixA(i, j) = basisFunction.evaluate((outputCoords.col(i) - inputCoords.col(j)).norm());
     }
 
-    const auto reduced = utils::reduceVector(outputMesh.vertices()[i].getCoords(), deadAxis);
-
     for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixA(i, inputSize + 1 + dim) = reduced[dim];
+      matrixA(i, inputSize + 1 + dim) = outputCoords(dim, i);
     }
     matrixA(i, inputSize) = 1.0;
   }
   return matrixA;
 }
 
+/// Builds the polynomial matrix of the interpolation system, consisting of a constant and the live coordinates
+inline Eigen::MatrixXd buildMatrixP(const mesh::Mesh &inputMesh, std::vector<bool> deadAxis)
+{
+  const Eigen::MatrixXd inputCoords = reducedVertexCoordinates(inputMesh, deadAxis);
+
+  Eigen::MatrixXd matrixP(inputCoords.cols(), 1 + inputCoords.rows());
+  matrixP.col(0).setOnes();
+  matrixP.rightCols(inputCoords.rows()) = inputCoords.transpose();
+  return matrixP;
+}
+
+/**
+ * @brief Builds the lower triangle of the kernel matrix for a basis function with compact support.
+ *
+ * Only the input vertices within the support radius are evaluated, which are found using the index of the input mesh.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::SparseMatrix<double> buildSparseMatrixC(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, query::Index &inputIndex, std::vector<bool> deadAxis)
+{
+  const int inputSize = inputMesh.vertices().size();
+
+  const Eigen::MatrixXd inputCoords  = reducedVertexCoordinates(inputMesh, deadAxis);
+  const auto            searchCoords = inputMesh.vertexCoordinates();
+  const SupportBox      supportBox(inputMesh, deadAxis, basisFunction.getSupportRadius());
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int i = 0; i < inputSize; ++i) {
+    for (VertexID j : inputIndex.getVerticesInsideBox(supportBox.around(searchCoords.col(i)))) {
+      if (j < i) {
+        continue;
+      }
+      const double value = basisFunction.evaluate((inputCoords.col(i) - inputCoords.col(j)).norm());
+      if (value != 0.0) {
+        entries.emplace_back(j, i, value);
+      }
+    }
+  }
+
+  Eigen::SparseMatrix<double> matrixC(inputSize, inputSize);
+  matrixC.setFromTriplets(entries.begin(), entries.end());
+  return matrixC;
+}
+
+/**
+ * @brief Estimates the fraction of non-zero entries of the kernel matrix for a basis function with compact support.
+ *
+ * Counts the input vertices within the support radius of up to 64 evenly spread input vertices.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+double estimateKernelFill(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, query::Index &inputIndex, std::vector<bool> deadAxis)
+{
+  const int inputSize = inputMesh.vertices().size();
+  if (inputSize == 0) {
+    return 0.0;
+  }
+
+  const Eigen::MatrixXd inputCoords  = reducedVertexCoordinates(inputMesh, deadAxis);
+  const auto            searchCoords = inputMesh.vertexCoordinates();
+  const SupportBox      supportBox(inputMesh, deadAxis, basisFunction.getSupportRadius());
+  const int             stride = std::max(1, inputSize / 64);
+
+  long neighbors = 0;
+  int  samples   = 0;
+  for (int i = 0; i < inputSize; i += stride, ++samples) {
+    for (VertexID j : inputIndex.getVerticesInsideBox(supportBox.around(searchCoords.col(i)))) {
+      if (basisFunction.evaluate((inputCoords.col(i) - inputCoords.col(j)).norm()) != 0.0) {
+        ++neighbors;
+      }
+    }
+  }
+  return static_cast<double>(neighbors) / samples / inputSize;
+}
+
+/// Builds the evaluation matrix for a basis function with compact support, see buildMatrixA() and buildSparseMatrixC()
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::SparseMatrix<double, Eigen::RowMajor> buildSparseMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, query::Index &inputIndex, const mesh::Mesh &outputMesh, std::vector<bool> deadAxis)
+{
+  const int inputSize  = inputMesh.vertices().size();
+  const int outputSize = outputMesh.vertices().size();
+
+  const Eigen::MatrixXd inputCoords    = reducedVertexCoordinates(inputMesh, deadAxis);
+  const Eigen::MatrixXd outputCoords   = reducedVertexCoordinates(outputMesh, deadAxis);
+  const auto            searchCoords   = outputMesh.vertexCoordinates();
+  const int             liveDimensions = inputCoords.rows();
+  const SupportBox      supportBox(inputMesh, deadAxis, basisFunction.getSupportRadius());
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int i = 0; i < outputSize; ++i) {
+    for (VertexID j : inputIndex.getVerticesInsideBox(supportBox.around(searchCoords.col(i)))) {
+      const double value = basisFunction.evaluate((outputCoords.col(i) - inputCoords.col(j)).norm());
+      if (value != 0.0) {
+        entries.emplace_back(i, j, value);
+      }
+    }
+
+    entries.emplace_back(i, inputSize, 1.0);
+    for (int dim = 0; dim < liveDimensions; dim++) {
+      entries.emplace_back(i, inputSize + 1 + dim, outputCoords(dim, i));
+    }
+  }
+
+  Eigen::SparseMatrix<double, Eigen::RowMajor> matrixA(outputSize, inputSize + 1 + liveDimensions);
+  matrixA.setFromTriplets(entries.begin(), entries.end());
+  return matrixA;
+}
+
 } // namespace mapping
 } // namespace precice
@@ -11,6 +11,7 @@
 #include "mapping/NearestNeighborGradientMapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
@@ -55,6 +56,10 @@ MappingConfiguration::MappingConfiguration(
                                .setOptions({"estimate", "compute", "off", "save", "tree"});
   auto attrUseLU = makeXMLAttribute(ATTR_USE_QR, false)
                        .setDocumentation("If set to true, QR decomposition is used to solve the RBF system");
+  auto attrVerticesPerCluster = makeXMLAttribute(ATTR_VERTICES_PER_CLUSTER, 50)
+                                    .setDocumentation("Targeted number of input vertices per cluster of the partition of unity");
+  auto attrRelativeOverlap = makeXMLAttribute(ATTR_RELATIVE_OVERLAP, 0.3)
+                                 .setDocumentation("Overlap of the clusters of the partition of unity relative to their distance");
 
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag>  tags;
@@ -114,6 +119,59 @@ MappingConfiguration::MappingConfiguration(
     tag.addAttribute(attrZDead);
     tag.addAttribute(attrUseLU);
   }
+  std::list<XMLTag> pumTags;
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_TPS, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the thin plate splines.");
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_MULTIQUADRICS, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the multiquadrics RBF.");
+    tag.addAttribute(attrShapeParam);
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_INV_MULTIQUADRICS, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the inverse multiquadrics RBF.");
+    tag.addAttribute(attrShapeParam);
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_VOLUME_SPLINES, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the volume-splines RBF.");
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_GAUSSIAN, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the Gaussian RBF with a cut-off threshold.");
+    tag.addAttribute(attrShapeParam);
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_CTPS_C2, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the C2-polynomial RBF.");
+    tag.addAttribute(attrSupportRadius);
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_CPOLYNOMIAL_C0, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the C0-polynomial RBF.");
+    tag.addAttribute(attrSupportRadius);
+    pumTags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_PUM_CPOLYNOMIAL_C6, occ, TAG);
+    tag.setDocumentation("Partition-of-unity radial-basis-function mapping based on the C6-polynomial RBF.");
+    tag.addAttribute(attrSupportRadius);
+    pumTags.push_back(tag);
+  }
+  // Add tags that only, but all partition-of-unity RBF mappings use
+  for (XMLTag &tag : pumTags) {
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
   {
     XMLTag tag(*this, VALUE_NEAREST_NEIGHBOR, occ, TAG);
     tag.setDocumentation("Nearest-neighbour mapping which uses a rstar-spacial index tree to index meshes and run nearest-neighbour queries.");
@@ -176,9 +234,11 @@ void MappingConfiguration::xmlTagCallback(
     double        supportRadius  = 0.0;
     double        solverRtol     = 1e-9;
     bool          xDead = false, yDead = false, zDead = false;
-    bool          useLU         = false;
-    Polynomial    polynomial    = Polynomial::ON;
-    Preallocation preallocation = Preallocation::TREE;
+    bool          useLU              = false;
+    int           verticesPerCluster = 50;
+    double        relativeOverlap    = 0.3;
+    Polynomial    polynomial         = Polynomial::ON;
+    Preallocation preallocation      = Preallocation::TREE;
 
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)) {
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -201,6 +261,12 @@ void MappingConfiguration::xmlTagCallback(
     if (tag.hasAttribute(ATTR_USE_QR)) {
       useLU = tag.getBooleanAttributeValue(ATTR_USE_QR);
     }
+    if (tag.hasAttribute(ATTR_VERTICES_PER_CLUSTER)) {
+      verticesPerCluster = tag.getIntAttributeValue(ATTR_VERTICES_PER_CLUSTER);
+    }
+    if (tag.hasAttribute(ATTR_RELATIVE_OVERLAP)) {
+      relativeOverlap = tag.getDoubleAttributeValue(ATTR_RELATIVE_OVERLAP);
+    }
     if (tag.hasAttribute("polynomial")) {
       std::string strPolynomial = tag.getStringAttributeValue("polynomial");
       if (strPolynomial == "separate")
@@ -230,7 +296,8 @@ void MappingConfiguration::xmlTagCallback(
                                                         shapeParameter, supportRadius, solverRtol,
                                                         xDead, yDead, zDead,
                                                         useLU,
-                                                        polynomial, preallocation);
+                                                        polynomial, preallocation,
+                                                        verticesPerCluster, relativeOverlap);
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
   }
@@ -262,7 +329,9 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     bool                             zDead,
     bool                             useLU,
     Polynomial                       polynomial,
-    Preallocation                    preallocation) const
+    Preallocation                    preallocation,
+    int                              verticesPerCluster,
+    double                           relativeOverlap) const
 {
   PRECICE_TRACE(direction, type, timing, shapeParameter, supportRadius);
   using namespace mapping;
@@ -316,6 +385,42 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
         new NearestNeighborGradientMapping(constraintValue, dimensions));
     configuredMapping.isRBF = false;
     return configuredMapping;
+  } else if (type == VALUE_RBF_PUM_TPS) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_MULTIQUADRICS) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<Multiquadrics>(
+            constraintValue, dimensions, Multiquadrics(shapeParameter), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_INV_MULTIQUADRICS) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<InverseMultiquadrics>(
+            constraintValue, dimensions, InverseMultiquadrics(shapeParameter), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_VOLUME_SPLINES) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_GAUSSIAN) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<Gaussian>(
+            constraintValue, dimensions, Gaussian(shapeParameter), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_CTPS_C2) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<CompactThinPlateSplinesC2>(
+            constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_CPOLYNOMIAL_C0) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<CompactPolynomialC0>(
+            constraintValue, dimensions, CompactPolynomialC0(supportRadius), verticesPerCluster, relativeOverlap));
+  } else if (type == VALUE_RBF_PUM_CPOLYNOMIAL_C6) {
+    configuredMapping.mapping = PtrMapping(
+        new PartitionOfUnityMapping<CompactPolynomialC6>(
+            constraintValue, dimensions, CompactPolynomialC6(supportRadius), verticesPerCluster, relativeOverlap));
+  }
+
+  if (configuredMapping.mapping) {
+    // Partition-of-unity mappings operate on the local partitions only, similar to the nearest-neighbor mapping
+    configuredMapping.isRBF = false;
+    return configuredMapping;
   }
 
   // the mapping is a RBF mapping
@@ -115,6 +115,9 @@ private:
   const std::string ATTR_Z_DEAD         = "z-dead";
   const std::string ATTR_USE_QR         = "use-qr-decomposition";
 
+  const std::string ATTR_VERTICES_PER_CLUSTER = "vertices-per-cluster";
+  const std::string ATTR_RELATIVE_OVERLAP     = "relative-overlap";
+
   const std::string VALUE_WRITE             = "write";
   const std::string VALUE_READ              = "read";
   const std::string VALUE_CONSISTENT        = "consistent";
@@ -132,6 +135,15 @@ private:
   const std::string VALUE_RBF_CPOLYNOMIAL_C0    = "rbf-compact-polynomial-c0";
   const std::string VALUE_RBF_CPOLYNOMIAL_C6    = "rbf-compact-polynomial-c6";
 
+  const std::string VALUE_RBF_PUM_TPS               = "rbf-pum-thin-plate-splines";
+  const std::string VALUE_RBF_PUM_MULTIQUADRICS     = "rbf-pum-multiquadrics";
+  const std::string VALUE_RBF_PUM_INV_MULTIQUADRICS = "rbf-pum-inverse-multiquadrics";
+  const std::string VALUE_RBF_PUM_VOLUME_SPLINES    = "rbf-pum-volume-splines";
+  const std::string VALUE_RBF_PUM_GAUSSIAN          = "rbf-pum-gaussian";
+  const std::string VALUE_RBF_PUM_CTPS_C2           = "rbf-pum-compact-tps-c2";
+  const std::string VALUE_RBF_PUM_CPOLYNOMIAL_C0    = "rbf-pum-compact-polynomial-c0";
+  const std::string VALUE_RBF_PUM_CPOLYNOMIAL_C6    = "rbf-pum-compact-polynomial-c6";
+
   const std::string VALUE_NEAREST_NEIGHBOR_GRADIENT = "nearest-neighbor-gradient";
 
   const std::string VALUE_TIMING_INITIAL    = "initial";
@@ -158,7 +170,9 @@ private:
       bool                             zDead,
       bool                             useLU,
       Polynomial                       polynomial,
-      Preallocation                    preallocation) const;
+      Preallocation                    preallocation,
+      int                              verticesPerCluster,
+      double                           relativeOverlap) const;
 
   /// Check whether a mapping to and from the same mesh already exists
   void checkDuplicates(const ConfiguredMapping &mapping);
@@ -6,6 +6,12 @@
 namespace precice {
 namespace mapping {
 
+/**
+ * Each basis function further defines isStrictlyPositiveDefinite(). Strictly positive definite basis
+ * functions result in positive definite kernel matrices, which allows to use Cholesky decompositions.
+ * The others are only conditionally positive definite.
+ */
+
 /// Base class for RBF with compact support
 struct CompactSupportBase {
   static constexpr bool hasCompactSupport()
@@ -36,6 +42,11 @@ struct NoCompactSupportBase {
  */
 class ThinPlateSplines : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return false;
+  }
+
   double evaluate(double radius) const
   {
     double result = 0.0;
@@ -55,6 +66,11 @@ public:
  */
 class Multiquadrics : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return false;
+  }
+
   explicit Multiquadrics(double c)
       : _cPow2(std::pow(c, 2)) {}
 
@@ -77,6 +93,11 @@ private:
  */
 class InverseMultiquadrics : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit InverseMultiquadrics(double c)
       : _cPow2(std::pow(c, 2))
   {
@@ -104,6 +125,11 @@ private:
  */
 class VolumeSplines : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return false;
+  }
+
   double evaluate(double radius) const
   {
     return std::abs(radius);
@@ -120,6 +146,11 @@ public:
  */
 class Gaussian : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   Gaussian(const double shape, const double supportRadius = std::numeric_limits<double>::infinity())
       : _shape(shape),
         _supportRadius(supportRadius)
@@ -176,6 +207,11 @@ private:
  */
 class CompactThinPlateSplinesC2 : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit CompactThinPlateSplinesC2(double supportRadius)
       : _r(supportRadius)
   {
@@ -216,6 +252,11 @@ private:
  */
 class CompactPolynomialC0 : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit CompactPolynomialC0(double supportRadius)
       : _r(supportRadius)
   {
@@ -253,6 +294,11 @@ private:
  */
 class CompactPolynomialC6 : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit CompactPolynomialC6(double supportRadius)
       : _r(supportRadius)
   {
@@ -0,0 +1,78 @@
+#include "mapping/impl/PartitionOfUnity.hpp"
+#include <algorithm>
+#include <cmath>
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+double estimateClusterSpacing(const Eigen::Ref<const Eigen::MatrixXd> &coordinates, int verticesPerCluster)
+{
+  PRECICE_ASSERT(verticesPerCluster > 0, verticesPerCluster);
+  PRECICE_ASSERT(coordinates.cols() > 0);
+
+  const Eigen::VectorXd extent    = coordinates.rowwise().maxCoeff() - coordinates.rowwise().minCoeff();
+  const double          maxExtent = extent.maxCoeff();
+  if (maxExtent <= 0.0) {
+    return 1.0; // All vertices coincide, hence any spacing results in a single cluster
+  }
+
+  // Measures the volume spanned along the axes the vertices actually extend along
+  double volume     = 1.0;
+  int    dimensions = 0;
+  for (int d = 0; d < extent.size(); ++d) {
+    if (extent[d] > 1e-10 * maxExtent) {
+      volume *= extent[d];
+      ++dimensions;
+    }
+  }
+
+  const double verticesPerVolume = coordinates.cols() / volume;
+  return std::pow(verticesPerCluster / verticesPerVolume, 1.0 / dimensions);
+}
+
+ClusterLayout createClusterLayout(const Eigen::VectorXd &lower, const Eigen::VectorXd &upper, double spacing, double relativeOverlap)
+{
+  PRECICE_ASSERT(lower.size() == upper.size(), lower.size(), upper.size());
+  PRECICE_ASSERT(spacing > 0.0, spacing);
+  PRECICE_ASSERT(relativeOverlap >= 0.0, relativeOverlap);
+  const int dimensions = lower.size();
+
+  // Per axis, the number of centers and their distance
+  Eigen::VectorXi counts(dimensions);
+  Eigen::VectorXd distances(dimensions);
+  for (int d = 0; d < dimensions; ++d) {
+    const double extent = std::max(upper[d] - lower[d], 0.0);
+    counts[d]           = std::max(1, static_cast<int>(std::ceil(extent / spacing)));
+    distances[d]        = extent / counts[d];
+  }
+
+  ClusterLayout layout;
+  layout.centers.resize(dimensions, counts.prod());
+  for (Eigen::Index i = 0; i < layout.centers.cols(); ++i) {
+    Eigen::Index rest = i;
+    for (int d = 0; d < dimensions; ++d) {
+      layout.centers(d, i) = lower[d] + (rest % counts[d] + 0.5) * distances[d];
+      rest /= counts[d];
+    }
+  }
+
+  const double halfDiagonal = 0.5 * distances.norm();
+  layout.radius             = (1.0 + relativeOverlap) * (halfDiagonal > 0.0 ? halfDiagonal : 0.5 * spacing);
+  return layout;
+}
+
+double evaluateClusterWeight(double distance, double radius)
+{
+  PRECICE_ASSERT(radius > 0.0, radius);
+  const double p = distance / radius;
+  if (p >= 1.0) {
+    return 0.0;
+  }
+  return std::pow(1.0 - p, 4) * (4.0 * p + 1.0);
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
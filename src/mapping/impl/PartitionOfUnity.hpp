@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Eigen/Core>
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/// Overlapping spherical clusters, whose centers are placed on a regular grid
+struct ClusterLayout {
+  /// The centers of the clusters, one per column
+  Eigen::MatrixXd centers;
+
+  /// The radius shared by all clusters
+  double radius = 0.0;
+};
+
+/**
+ * @brief Estimates the grid spacing of cluster centers, such that a cluster contains the requested number of vertices.
+ *
+ * The estimate assumes the vertices to be uniformly distributed within their bounding box.
+ * Axes along which the vertices do not extend are not taken into account.
+ *
+ * @param[in] coordinates the vertex coordinates, one vertex per column
+ * @param[in] verticesPerCluster the targeted number of vertices per cluster
+ */
+double estimateClusterSpacing(const Eigen::Ref<const Eigen::MatrixXd> &coordinates, int verticesPerCluster);
+
+/**
+ * @brief Covers the box given by its corners with overlapping clusters.
+ *
+ * The centers are placed on a regular grid with a spacing of at most the given spacing.
+ * The radius equals the half diagonal of a grid cell enlarged by the relative overlap,
+ * hence every location in the box is contained in at least one cluster.
+ */
+ClusterLayout createClusterLayout(const Eigen::VectorXd &lower, const Eigen::VectorXd &upper, double spacing, double relativeOverlap);
+
+/**
+ * @brief Evaluates the (non-normalized) partition-of-unity weight of a location in a cluster.
+ *
+ * Uses the Wendland C2 function, which decays smoothly to zero at the cluster radius.
+ */
+double evaluateClusterWeight(double distance, double radius);
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <memory>
+
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Solves the interpolation system of a RBF mapping using a decomposition of its kernel matrix.
+ *
+ * The interpolation system consists of the symmetric kernel matrix C and the polynomial matrix P:
+ *
+ *     | C   P | | x |   | f |
+ *     | P^T 0 | | b | = | g |
+ *
+ * The system is indefinite, but C is positive definite for strictly positive definite basis functions.
+ * Hence, C is factorized using a Cholesky-type decomposition. The polynomial coefficients b are then
+ * given by the small Schur complement P^T C^-1 P, and x follows by backsubstitution.
+ *
+ * @tparam DECOMPOSITION_T the decomposition of C, such as Eigen::LLT or Eigen::SimplicialLDLT
+ */
+template <typename DECOMPOSITION_T>
+class SchurRBFSolver {
+public:
+  /**
+   * @brief Factorizes the interpolation system.
+   *
+   * @param[in] kernel the kernel matrix C, of which only the lower triangle is used
+   * @param[in] polynomial the polynomial matrix P
+   *
+   * @returns false, if the kernel matrix or the Schur complement could not be factorized
+   */
+  template <typename MATRIX_T>
+  bool compute(const MATRIX_T &kernel, const Eigen::MatrixXd &polynomial);
+
+  /// Solves the system for the stacked right-hand sides (f, g), one per column, and returns the stacked solutions (x, b)
+  Eigen::MatrixXd solve(const Eigen::MatrixXd &rhs) const;
+
+  /// Returns the size of the interpolation system, zero if nothing has been computed
+  Eigen::Index size() const;
+
+  /// Releases all memory of the factorization
+  void clear();
+
+private:
+  /// Held by pointer, as sparse decompositions are not copyable
+  std::unique_ptr<DECOMPOSITION_T> _decomposition;
+
+  /// The polynomial matrix P
+  Eigen::MatrixXd _polynomial;
+
+  /// The inverse kernel matrix applied to the polynomial C^-1 P
+  Eigen::MatrixXd _kernelPolynomial;
+
+  /// Decomposition of the Schur complement P^T C^-1 P
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _schur;
+};
+
+// --------------------------------------------------------- HEADER DEFINITIONS
+
+template <typename DECOMPOSITION_T>
+template <typename MATRIX_T>
+bool SchurRBFSolver<DECOMPOSITION_T>::compute(const MATRIX_T &kernel, const Eigen::MatrixXd &polynomial)
+{
+  PRECICE_ASSERT(kernel.rows() == kernel.cols(), kernel.rows(), kernel.cols());
+  PRECICE_ASSERT(kernel.rows() == polynomial.rows(), kernel.rows(), polynomial.rows());
+  clear();
+
+  auto decomposition = std::make_unique<DECOMPOSITION_T>(kernel);
+  if (decomposition->info() != Eigen::Success) {
+    return false;
+  }
+
+  Eigen::MatrixXd kernelPolynomial = decomposition->solve(polynomial);
+  auto            schur            = (polynomial.transpose() * kernelPolynomial).colPivHouseholderQr();
+  if (not schur.isInvertible()) {
+    return false;
+  }
+
+  _decomposition    = std::move(decomposition);
+  _polynomial       = polynomial;
+  _kernelPolynomial = std::move(kernelPolynomial);
+  _schur            = std::move(schur);
+  return true;
+}
+
+template <typename DECOMPOSITION_T>
+Eigen::MatrixXd SchurRBFSolver<DECOMPOSITION_T>::solve(const Eigen::MatrixXd &rhs) const
+{
+  const Eigen::Index n          = _polynomial.rows();
+  const Eigen::Index polyparams = _polynomial.cols();
+  PRECICE_ASSERT(_decomposition);
+  PRECICE_ASSERT(rhs.rows() == n + polyparams, rhs.rows(), n, polyparams);
+
+  const Eigen::MatrixXd kernelRhs = _decomposition->solve(rhs.topRows(n));
+
+  Eigen::MatrixXd solution(n + polyparams, rhs.cols());
+  solution.bottomRows(polyparams) = _schur.solve(_polynomial.transpose() * kernelRhs - rhs.bottomRows(polyparams));
+  solution.topRows(n)             = kernelRhs - _kernelPolynomial * solution.bottomRows(polyparams);
+  return solution;
+}
+
+template <typename DECOMPOSITION_T>
+Eigen::Index SchurRBFSolver<DECOMPOSITION_T>::size() const
+{
+  return _decomposition ? _polynomial.rows() + _polynomial.cols() : 0;
+}
+
+template <typename DECOMPOSITION_T>
+void SchurRBFSolver<DECOMPOSITION_T>::clear()
+{
+  _decomposition.reset();
+  _polynomial       = Eigen::MatrixXd();
+  _kernelPolynomial = Eigen::MatrixXd();
+  _schur            = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,66 @@
+#include "mapping/impl/SparseOperator.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+namespace {
+using RowMajorValues = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+} // namespace
+
+void SparseOperator::assemble(Eigen::Index rows, Eigen::Index cols, const std::vector<Triplet> &entries)
+{
+  _matrix.resize(rows, cols);
+  _matrix.setFromTriplets(entries.begin(), entries.end());
+  _matrix.makeCompressed();
+}
+
+void SparseOperator::assemble(Eigen::Index cols, const std::vector<int> &columnIndices)
+{
+  // Every row holds exactly one entry, hence the compressed storage is filled directly
+  const auto rows = static_cast<Eigen::Index>(columnIndices.size());
+  _matrix.resize(rows, cols);
+  _matrix.resizeNonZeros(rows);
+  for (Eigen::Index i = 0; i < rows; ++i) {
+    PRECICE_ASSERT(columnIndices[i] >= 0 && columnIndices[i] < cols, columnIndices[i], cols);
+    _matrix.outerIndexPtr()[i] = static_cast<Matrix::StorageIndex>(i);
+    _matrix.innerIndexPtr()[i] = static_cast<Matrix::StorageIndex>(columnIndices[i]);
+    _matrix.valuePtr()[i]      = 1.0;
+  }
+  _matrix.outerIndexPtr()[rows] = static_cast<Matrix::StorageIndex>(rows);
+}
+
+void SparseOperator::apply(const Eigen::VectorXd &inputValues, Eigen::VectorXd &outputValues, int valueDimensions) const
+{
+  PRECICE_ASSERT(inputValues.size() == _matrix.cols() * valueDimensions, inputValues.size(), _matrix.cols(), valueDimensions);
+  PRECICE_ASSERT(outputValues.size() == _matrix.rows() * valueDimensions, outputValues.size(), _matrix.rows(), valueDimensions);
+
+  Eigen::Map<const RowMajorValues> in(inputValues.data(), _matrix.cols(), valueDimensions);
+  Eigen::Map<RowMajorValues>       out(outputValues.data(), _matrix.rows(), valueDimensions);
+  out.noalias() += _matrix * in;
+}
+
+void SparseOperator::applyTransposed(const Eigen::VectorXd &inputValues, Eigen::VectorXd &outputValues, int valueDimensions) const
+{
+  PRECICE_ASSERT(inputValues.size() == _matrix.rows() * valueDimensions, inputValues.size(), _matrix.rows(), valueDimensions);
+  PRECICE_ASSERT(outputValues.size() == _matrix.cols() * valueDimensions, outputValues.size(), _matrix.cols(), valueDimensions);
+
+  Eigen::Map<const RowMajorValues> in(inputValues.data(), _matrix.rows(), valueDimensions);
+  Eigen::Map<RowMajorValues>       out(outputValues.data(), _matrix.cols(), valueDimensions);
+  out.noalias() += _matrix.transpose() * in;
+}
+
+const SparseOperator::Matrix &SparseOperator::matrix() const
+{
+  return _matrix;
+}
+
+void SparseOperator::clear()
+{
+  _matrix = Matrix();
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <vector>
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Linear mapping compiled into a sparse matrix in compressed row storage.
+ *
+ * The rows of the matrix correspond to the vertices the mapping is computed for,
+ * the columns to the vertices they are interpolated from.
+ * Data values are stored interleaved per vertex, hence they are viewed as a row-major matrix
+ * with one row per vertex and one column per data dimension. This maps all data dimensions
+ * with a single sparse matrix-matrix product.
+ */
+class SparseOperator {
+public:
+  using Matrix  = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+  using Triplet = Eigen::Triplet<double>;
+
+  /// Assembles the operator from the given entries, duplicated entries are summed up
+  void assemble(Eigen::Index rows, Eigen::Index cols, const std::vector<Triplet> &entries);
+
+  /// Assembles the operator mapping every row to a single column with weight one
+  void assemble(Eigen::Index cols, const std::vector<int> &columnIndices);
+
+  /// Adds the values mapped by the operator to the output values
+  void apply(const Eigen::VectorXd &inputValues, Eigen::VectorXd &outputValues, int valueDimensions) const;
+
+  /// Adds the values mapped by the transposed operator to the output values
+  void applyTransposed(const Eigen::VectorXd &inputValues, Eigen::VectorXd &outputValues, int valueDimensions) const;
+
+  const Matrix &matrix() const;
+
+  void clear();
+
+private:
+  Matrix _matrix;
+};
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -50,5 +50,29 @@ BOOST_AUTO_TEST_CASE(Configuration)
   BOOST_TEST(mappingConfig.mappings().at(2).direction == MappingConfiguration::WRITE);
 }
 
+BOOST_AUTO_TEST_CASE(PartitionOfUnity)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-pum-config.xml");
+  using xml::XMLTag;
+  XMLTag                     tag = xml::getRootTag();
+  mesh::PtrDataConfiguration dataConfig(new mesh::DataConfiguration(tag));
+  dataConfig->setDimensions(3);
+  mesh::PtrMeshConfiguration meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  meshConfig->setDimensions(3);
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(mappingConfig.mappings().size() == 2);
+  for (const auto &configuredMapping : mappingConfig.mappings()) {
+    BOOST_TEST(not configuredMapping.isRBF);
+    BOOST_TEST(configuredMapping.mapping);
+  }
+  BOOST_TEST(mappingConfig.mappings().at(0).mapping->hasConstraint(Mapping::CONSISTENT));
+  BOOST_TEST(mappingConfig.mappings().at(1).mapping->hasConstraint(Mapping::CONSERVATIVE));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
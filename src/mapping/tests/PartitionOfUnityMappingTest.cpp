@@ -0,0 +1,180 @@
+#include <Eigen/Core>
+#include <vector>
+#include "mapping/Mapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mapping/impl/PartitionOfUnity.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Threading.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using namespace precice::mesh;
+
+namespace {
+
+/// Creates a regular 2D grid of n x n vertices on the unit square with a single data field
+PtrMesh createGrid(const std::string &name, int n, double shift, int dataDimensions)
+{
+  PtrMesh mesh(new Mesh(name, 2, testing::nextMeshID()));
+  mesh->createData("Data", dataDimensions);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      mesh->createVertex(Eigen::Vector2d(shift + i / (n - 1.0), 0.5 * shift + j / (n - 1.0)));
+    }
+  }
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+/// Evaluates a linear function at all vertices of the mesh, interleaved per data dimension
+Eigen::VectorXd linearFunction(const Mesh &mesh, int dataDimensions)
+{
+  const auto      coords = mesh.vertexCoordinates();
+  Eigen::VectorXd values(coords.cols() * dataDimensions);
+  for (int i = 0; i < coords.cols(); ++i) {
+    for (int dim = 0; dim < dataDimensions; ++dim) {
+      values[i * dataDimensions + dim] = 1.0 + (dim + 2) * coords(0, i) - 3.0 * coords(1, i);
+    }
+  }
+  return values;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(PartitionOfUnityMapping)
+
+BOOST_AUTO_TEST_CASE(ClusterLayoutCoversBox)
+{
+  PRECICE_TEST(1_rank);
+  const Eigen::Vector3d lower(0.0, -1.0, 2.0);
+  const Eigen::Vector3d upper(1.0, 1.0, 2.0);
+  const auto            layout = impl::createClusterLayout(lower, upper, 0.3, 0.2);
+
+  // Four centers along x, seven along y and one along the flat z axis
+  BOOST_TEST(layout.centers.cols() == 4 * 7 * 1);
+  BOOST_TEST(layout.radius > 0.0);
+
+  Eigen::MatrixXd samples = Eigen::MatrixXd::Random(3, 200);
+  for (int i = 0; i < samples.cols(); ++i) {
+    const Eigen::Vector3d location = lower + (0.5 * (samples.col(i).array() + 1.0) * (upper - lower).array()).matrix();
+    const double          distance = (layout.centers.colwise() - location).colwise().norm().minCoeff();
+    BOOST_TEST(impl::evaluateClusterWeight(distance, layout.radius) > 0.0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ClusterSpacing)
+{
+  PRECICE_TEST(1_rank);
+  // 100 vertices on a line of length 1, clusters of 10 vertices
+  Eigen::MatrixXd line = Eigen::MatrixXd::Zero(3, 100);
+  line.row(1)          = Eigen::RowVectorXd::LinSpaced(100, 0.0, 1.0);
+  BOOST_TEST(impl::estimateClusterSpacing(line, 10) == 0.1, boost::test_tools::tolerance(1e-12));
+
+  // 400 vertices on a unit square, clusters of 25 vertices
+  Eigen::MatrixXd square(2, 400);
+  for (int i = 0; i < 400; ++i) {
+    square.col(i) = Eigen::Vector2d((i % 20) / 19.0, (i / 20) / 19.0);
+  }
+  BOOST_TEST(impl::estimateClusterSpacing(square, 25) == 0.25, boost::test_tools::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(ConsistentLinear)
+{
+  PRECICE_TEST(1_rank);
+  const int dataDimensions = 2;
+  PtrMesh   inMesh         = createGrid("InMesh", 20, 0.0, dataDimensions);
+  PtrMesh   outMesh        = createGrid("OutMesh", 13, 0.01, dataDimensions);
+  inMesh->data("Data")->values() = linearFunction(*inMesh, dataDimensions);
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), 20, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(not mapping.hasComputedMapping());
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping());
+  mapping.map(inMesh->data("Data")->getID(), outMesh->data("Data")->getID());
+
+  // Linear functions are reproduced by every local interpolant, hence by their partition of unity
+  BOOST_TEST(testing::equals(outMesh->data("Data")->values(), linearFunction(*outMesh, dataDimensions), 1e-8));
+
+  mapping.clear();
+  BOOST_TEST(not mapping.hasComputedMapping());
+}
+
+BOOST_AUTO_TEST_CASE(ConsistentExtrapolation)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh            = createGrid("InMesh", 10, 0.0, 1);
+  inMesh->data("Data")->values() = linearFunction(*inMesh, 1);
+
+  PtrMesh outMesh(new Mesh("OutMesh", 2, testing::nextMeshID()));
+  outMesh->createData("Data", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.5, 0.5));
+  outMesh->createVertex(Eigen::Vector2d(3.0, 0.5));
+  outMesh->allocateDataValues();
+
+  mapping::PartitionOfUnityMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, 2, CompactPolynomialC6(0.5), 10, 0.2);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inMesh->data("Data")->getID(), outMesh->data("Data")->getID());
+
+  // The vertex outside of all clusters is extrapolated by the polynomial of the closest cluster
+  BOOST_TEST(testing::equals(outMesh->data("Data")->values(), linearFunction(*outMesh, 1), 1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(Conservative)
+{
+  PRECICE_TEST(1_rank);
+  const int dataDimensions = 2;
+  PtrMesh   inMesh         = createGrid("InMesh", 13, 0.01, dataDimensions);
+  PtrMesh   outMesh        = createGrid("OutMesh", 20, 0.0, dataDimensions);
+  inMesh->data("Data")->values().setRandom();
+
+  mapping::PartitionOfUnityMapping<Gaussian> mapping(Mapping::CONSERVATIVE, 2, Gaussian(15.0), 30, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inMesh->data("Data")->getID(), outMesh->data("Data")->getID());
+
+  // The sum of each data dimension is conserved
+  const auto &in  = inMesh->data("Data")->values();
+  const auto &out = outMesh->data("Data")->values();
+  for (int dim = 0; dim < dataDimensions; ++dim) {
+    const double inSum  = Eigen::Map<const Eigen::VectorXd, 0, Eigen::InnerStride<>>(in.data() + dim, in.size() / dataDimensions, Eigen::InnerStride<>(dataDimensions)).sum();
+    const double outSum = Eigen::Map<const Eigen::VectorXd, 0, Eigen::InnerStride<>>(out.data() + dim, out.size() / dataDimensions, Eigen::InnerStride<>(dataDimensions)).sum();
+    BOOST_TEST(inSum == outSum, boost::test_tools::tolerance(1e-9));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Threads)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh            = createGrid("InMesh", 30, 0.0, 1);
+  PtrMesh outMesh           = createGrid("OutMesh", 17, 0.02, 1);
+  inMesh->data("Data")->values() = inMesh->vertexCoordinates().colwise().squaredNorm().transpose();
+
+  mapping::PartitionOfUnityMapping<InverseMultiquadrics> mapping(Mapping::CONSISTENT, 2, InverseMultiquadrics(0.1), 25, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inMesh->data("Data")->getID(), outMesh->data("Data")->getID());
+  const Eigen::VectorXd serial = outMesh->data("Data")->values();
+  mapping.clear();
+
+  utils::Threading::setNumberOfThreads(4);
+  mapping.computeMapping();
+  mapping.map(inMesh->data("Data")->getID(), outMesh->data("Data")->getID());
+  utils::Threading::setNumberOfThreads(1);
+
+  BOOST_TEST(testing::equals(outMesh->data("Data")->values(), serial, 1e-12));
+
+  // The quadratic function is approximated closely
+  const Eigen::VectorXd expected = outMesh->vertexCoordinates().colwise().squaredNorm().transpose();
+  BOOST_TEST(testing::equals(serial, expected, 1e-3));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PartitionOfUnityMapping
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
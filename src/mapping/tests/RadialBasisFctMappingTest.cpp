@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -14,6 +15,7 @@
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Utils.hpp"
 #include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 
@@ -156,8 +158,8 @@ void testDistributed(const TestContext &    context,
 BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1)
 {
   PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
-  Gaussian                        fct(5.0);
-  RadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
+  InverseMultiquadrics                        fct(1e-3);
+  RadialBasisFctMapping<InverseMultiquadrics> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
 
   testDistributed(context, mapping,
                   {// Consistent mapping: The inMesh is communicated
@@ -192,8 +194,8 @@ BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1)
 BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1Vector)
 {
   PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
-  Gaussian                        fct(5.0);
-  RadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
+  InverseMultiquadrics                        fct(1e-3);
+  RadialBasisFctMapping<InverseMultiquadrics> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
 
   testDistributed(context, mapping,
                   {// Consistent mapping: The inMesh is communicated
@@ -229,8 +231,8 @@ BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1Vector)
 BOOST_AUTO_TEST_CASE(DistributedConsistent2DV2)
 {
   PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
-  Gaussian                        fct(5.0);
-  RadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
+  InverseMultiquadrics                        fct(1e-3);
+  RadialBasisFctMapping<InverseMultiquadrics> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
 
   testDistributed(context, mapping,
                   {// Consistent mapping: The inMesh is communicated, rank 2 owns no vertices
@@ -2002,6 +2004,194 @@ BOOST_AUTO_TEST_CASE(DeadAxis3D)
   BOOST_TEST(outData->values()(3) == 4.3);
 }
 
+/// Compares the assembly from the contiguous vertex coordinates against the per-vertex assembly
+BOOST_AUTO_TEST_CASE(AssemblyFromVertexCoordinates)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector3d;
+  using clock = std::chrono::steady_clock;
+
+  Gaussian          fct(1.0);
+  std::vector<bool> deadAxis{false, true, false};
+
+  mesh::Mesh mesh("InMesh", 3, testing::nextMeshID());
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      for (int k = 0; k < 10; ++k) {
+        mesh.createVertex(Vector3d(0.1 * i, 0.2 * j, 0.3 * k));
+      }
+    }
+  }
+  const int inputSize = mesh.vertices().size();
+
+  // Assembly via the Vertex interface
+  auto            start = clock::now();
+  Eigen::MatrixXd reference(inputSize + 3, inputSize + 3);
+  reference.setZero();
+  for (int i = 0; i < inputSize; ++i) {
+    for (int j = i; j < inputSize; ++j) {
+      const auto &u   = mesh.vertices()[i].getCoords();
+      const auto &v   = mesh.vertices()[j].getCoords();
+      reference(i, j) = fct.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+    }
+    const auto reduced = utils::reduceVector(mesh.vertices()[i].getCoords(), deadAxis);
+    for (int dim = 0; dim < 2; dim++) {
+      reference(i, inputSize + 1 + dim) = reduced[dim];
+    }
+    reference(i, inputSize) = 1.0;
+  }
+  reference.triangularView<Eigen::Lower>() = reference.transpose();
+  const std::chrono::duration<double> before = clock::now() - start;
+
+  // Assembly via the contiguous coordinates of the mesh
+  start                                     = clock::now();
+  Eigen::MatrixXd                     matrix = buildMatrixCLU(fct, mesh, deadAxis);
+  const std::chrono::duration<double> after  = clock::now() - start;
+
+  BOOST_TEST(equals(matrix, reference));
+  BOOST_TEST_MESSAGE("Assembly of " << inputSize << " vertices: per vertex " << before.count()
+                                    << "s, contiguous " << after.count() << "s");
+}
+
+/// Compares the sparse path for basis functions with compact support against the dense path
+BOOST_AUTO_TEST_CASE(SparseCompactSupport)
+{
+  PRECICE_TEST(1_rank);
+  using clock = std::chrono::steady_clock;
+
+  const int           n = 12;
+  const double        h = 0.1;
+  CompactPolynomialC6 fct(2.5 * h);
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", 3, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", 3, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        inMesh->createVertex(Eigen::Vector3d(h * i, h * j, h * k));
+        outMesh->createVertex(Eigen::Vector3d(h * i + 0.03, h * j + 0.02, h * k + 0.01));
+      }
+    }
+  }
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  addGlobalIndex(outMesh);
+  const auto inCoords = inMesh->vertexCoordinates();
+  inData->values()    = (inCoords.row(0) + 2 * inCoords.row(1) + inCoords.row(2).array().square().matrix()).transpose();
+
+  // Sparse path, selected automatically for compact support
+  RadialBasisFctMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, 3, fct, false, false, false);
+  mapping.setMeshes(inMesh, outMesh);
+  auto start = clock::now();
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  const std::chrono::duration<double> sparseTime = clock::now() - start;
+
+  // Dense reference
+  const std::vector<bool> deadAxis(3, false);
+  start                     = clock::now();
+  Eigen::MatrixXd matrixA   = buildMatrixA(fct, *inMesh, *outMesh, deadAxis);
+  Eigen::MatrixXd matrixCLU = buildMatrixCLU(fct, *inMesh, deadAxis);
+  Eigen::VectorXd rhs       = Eigen::VectorXd::Zero(matrixCLU.rows());
+
+  rhs.head(inData->values().size()) = inData->values();
+  Eigen::VectorXd reference         = matrixA * matrixCLU.colPivHouseholderQr().solve(rhs);
+  const std::chrono::duration<double> denseTime = clock::now() - start;
+
+  BOOST_TEST(equals(outData->values(), reference, 1e-8));
+
+  // Memory estimates based on the non-zeros of the sparse matrices
+  query::Index index(inMesh);
+  const auto   sparseA      = buildSparseMatrixA(fct, *inMesh, index, *outMesh, deadAxis);
+  const auto   sparseC      = buildSparseMatrixC(fct, *inMesh, index, deadAxis);
+  BOOST_TEST(estimateKernelFill(fct, *inMesh, index, deadAxis) < maxSparseFill);
+  // The Gaussian is truncated, but its support covers most of the mesh
+  BOOST_TEST(estimateKernelFill(Gaussian(5.0), *inMesh, index, deadAxis) > maxSparseFill);
+  const double denseMemory  = (matrixA.size() + matrixCLU.size()) * sizeof(double);
+  const double sparseMemory = (sparseA.nonZeros() + sparseC.nonZeros()) * (sizeof(double) + sizeof(int));
+  BOOST_TEST(sparseMemory < denseMemory);
+  BOOST_TEST_MESSAGE("RBF mapping of " << inMesh->vertices().size() << " vertices: dense " << denseTime.count() << "s and "
+                                       << denseMemory / 1e6 << "MB, sparse " << sparseTime.count() << "s and "
+                                       << sparseMemory / 1e6 << "MB");
+}
+
+/// Maps vector data on an n x n grid and compares against a QR decomposition of the full system, one data dimension at a time
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testCholeskyVectorData(RADIAL_BASIS_FUNCTION_T fct, int n)
+{
+  const int    dimensions = 2;
+  const double h          = 1.0 / (n - 1);
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", dimensions);
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", dimensions);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      inMesh->createVertex(Eigen::Vector2d(h * i, h * j));
+      outMesh->createVertex(Eigen::Vector2d(h * i + 0.4 * h, h * j + 0.2 * h));
+    }
+  }
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  addGlobalIndex(outMesh);
+  const auto inCoords = inMesh->vertexCoordinates();
+  for (int i = 0; i < inCoords.cols(); ++i) {
+    inData->values()(i * dimensions)     = inCoords(0, i) + inCoords(1, i);
+    inData->values()(i * dimensions + 1) = inCoords(0, i) * inCoords(1, i);
+  }
+
+  RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  const std::vector<bool> deadAxis(dimensions, false);
+  Eigen::MatrixXd         matrixA   = buildMatrixA(fct, *inMesh, *outMesh, deadAxis);
+  Eigen::MatrixXd         matrixCLU = buildMatrixCLU(fct, *inMesh, deadAxis);
+  auto                    qr        = matrixCLU.colPivHouseholderQr();
+  for (int dim = 0; dim < dimensions; ++dim) {
+    Eigen::VectorXd rhs = Eigen::VectorXd::Zero(matrixCLU.rows());
+    for (int i = 0; i < inCoords.cols(); ++i) {
+      rhs(i) = inData->values()(i * dimensions + dim);
+    }
+    const Eigen::VectorXd reference = matrixA * qr.solve(rhs);
+    for (int i = 0; i < reference.size(); ++i) {
+      BOOST_TEST(outData->values()(i * dimensions + dim) == reference(i), boost::test_tools::tolerance(1e-6));
+    }
+  }
+}
+
+/// Strictly positive definite without compact support, hence factorized by a dense LLT decomposition
+BOOST_AUTO_TEST_CASE(CholeskyVectorData)
+{
+  PRECICE_TEST(1_rank);
+  testCholeskyVectorData(InverseMultiquadrics(1e-3), 5);
+}
+
+/// Compact support with a sparse kernel matrix, hence factorized by a sparse LDLT decomposition
+BOOST_AUTO_TEST_CASE(CholeskyVectorDataSparse)
+{
+  PRECICE_TEST(1_rank);
+  const int           n = 24;
+  CompactPolynomialC6 fct(3.0 / (n - 1));
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      mesh->createVertex(Eigen::Vector2d(i, j) / (n - 1));
+    }
+  }
+  query::Index index(mesh);
+  BOOST_TEST(estimateKernelFill(fct, *mesh, index, {false, false}) < maxSparseFill);
+
+  testCholeskyVectorData(fct, n);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE_END() // RadialBasisFunctionMapping
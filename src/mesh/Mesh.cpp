@@ -1,6 +1,5 @@
 #include <Eigen/Core>
 #include <algorithm>
-#include <array>
 #include <boost/container/flat_map.hpp>
 #include <functional>
 #include <memory>
@@ -34,7 +33,7 @@ Mesh::Mesh(
   PRECICE_ASSERT((_dimensions == 2) || (_dimensions == 3), _dimensions);
   PRECICE_ASSERT(_name != std::string(""));
 
-  meshChanged.connect([](Mesh &m) { query::clearCache(m); });
+  meshChanged.connect([](Mesh &m) { query::updateCache(m); });
   meshDestroyed.connect([](Mesh &m) { query::clearCache(m); });
 }
 
@@ -78,20 +77,53 @@ int Mesh::getDimensions() const
   return _dimensions;
 }
 
+Eigen::Map<const Eigen::MatrixXd> Mesh::vertexCoordinates() const
+{
+  PRECICE_ASSERT(_vertexCoordinates.size() == _vertices.size() * _dimensions, _vertexCoordinates.size(), _vertices.size());
+  return {_vertexCoordinates.data(), _dimensions, static_cast<Eigen::Index>(_vertices.size())};
+}
+
+std::size_t Mesh::getVertexRevision() const
+{
+  return _vertexRevision;
+}
+
 Vertex &Mesh::createVertex(const Eigen::VectorXd &coords)
 {
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
   _vertices.emplace_back(coords, nextID);
+  _vertexCoordinates.insert(_vertexCoordinates.end(), coords.data(), coords.data() + _dimensions);
+  _vertices.back()._mesh = this;
+  ++_vertexRevision;
   return _vertices.back();
 }
 
+void Mesh::updateVertexCoordinates(const Vertex &vertex)
+{
+  PRECICE_ASSERT(vertex._mesh == this);
+  std::copy_n(vertex.rawCoords().data(), _dimensions, _vertexCoordinates.data() + static_cast<size_t>(vertex.getID()) * _dimensions);
+  ++_vertexRevision;
+}
+
+void Mesh::reserve(size_t additionalVertices, size_t additionalEdges)
+{
+  // Grow geometrically, such that appending several meshes does not copy the coordinates every time
+  const size_t coordinates = (_vertices.size() + additionalVertices) * _dimensions;
+  if (coordinates > _vertexCoordinates.capacity()) {
+    _vertexCoordinates.reserve(std::max(coordinates, 2 * _vertexCoordinates.capacity()));
+  }
+  _edgeIndex.reserve(_edges.size() + additionalEdges);
+}
+
 Edge &Mesh::createEdge(
     Vertex &vertexOne,
     Vertex &vertexTwo)
 {
   auto nextID = _edges.size();
   _edges.emplace_back(vertexOne, vertexTwo, nextID);
+  // Keeps the first edge if the edge was already created before
+  _edgeIndex.emplace(edgeKey(vertexOne, vertexTwo), nextID);
   return _edges.back();
 }
 
@@ -99,20 +131,21 @@ Edge &Mesh::createUniqueEdge(
     Vertex &vertexOne,
     Vertex &vertexTwo)
 {
-  const std::array<VertexID, 2> vids{vertexOne.getID(), vertexTwo.getID()};
-  const auto                    eend = edges().end();
-  auto                          pos  = std::find_if(edges().begin(), eend,
-                          [&vids](const Edge &e) -> bool {
-                            const std::array<VertexID, 2> eids{e.vertex(0).getID(), e.vertex(1).getID()};
-                            return std::is_permutation(vids.begin(), vids.end(), eids.begin());
-                          });
-  if (pos != eend) {
-    return *pos;
+  auto pos = _edgeIndex.find(edgeKey(vertexOne, vertexTwo));
+  if (pos != _edgeIndex.end()) {
+    return _edges[pos->second];
   } else {
     return createEdge(vertexOne, vertexTwo);
   }
 }
 
+Mesh::EdgeKey Mesh::edgeKey(const Vertex &vertexOne, const Vertex &vertexTwo)
+{
+  const VertexID a = vertexOne.getID();
+  const VertexID b = vertexTwo.getID();
+  return (a < b) ? EdgeKey{a, b} : EdgeKey{b, a};
+}
+
 Triangle &Mesh::createTriangle(
     Edge &edgeOne,
     Edge &edgeTwo,
@@ -273,8 +306,14 @@ void Mesh::computeBoundingBox()
   // Keep the bounding box if set via the API function.
   BoundingBox bb = _boundingBox.empty() ? BoundingBox(_dimensions) : BoundingBox(_boundingBox);
 
-  for (const Vertex &vertex : _vertices) {
-    bb.expandBy(vertex);
+  if (not _vertices.empty()) {
+    const auto          coords = vertexCoordinates();
+    std::vector<double> bounds(2 * _dimensions);
+    for (int d = 0; d < _dimensions; ++d) {
+      bounds[2 * d]     = coords.row(d).minCoeff();
+      bounds[2 * d + 1] = coords.row(d).maxCoeff();
+    }
+    bb.expandBy(BoundingBox(std::move(bounds)));
   }
   _boundingBox = std::move(bb);
   PRECICE_DEBUG("Bounding Box, {}", _boundingBox);
@@ -284,7 +323,10 @@ void Mesh::clear()
 {
   _triangles.clear();
   _edges.clear();
+  _edgeIndex.clear();
   _vertices.clear();
+  _vertexCoordinates.clear();
+  ++_vertexRevision;
 
   meshChanged(*this);
 
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <boost/functional/hash.hpp>
 #include <boost/signals2.hpp>
 #include <deque>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "logging/Logger.hpp"
@@ -93,9 +96,36 @@ public:
 
   int getDimensions() const;
 
+  /**
+   * @brief Returns the coordinates of all vertices as a contiguous (dimensions x vertices) matrix.
+   *
+   * The column i holds the coordinates of the vertex with ID i.
+   * This allows to iterate over all coordinates without allocating temporaries.
+   * The view is invalidated when vertices are created or the mesh is cleared.
+   */
+  Eigen::Map<const Eigen::MatrixXd> vertexCoordinates() const;
+
+  /// Returns the revision of the vertices, which changes whenever vertices are created, moved, or removed.
+  std::size_t getVertexRevision() const;
+
+  /// Returns the coordinates of all vertices as a contiguous matrix with a fixed number of rows.
+  template <int Dim>
+  Eigen::Map<const Eigen::Matrix<double, Dim, Eigen::Dynamic>> vertexCoordinates() const
+  {
+    PRECICE_ASSERT(Dim == _dimensions, Dim, _dimensions);
+    return {_vertexCoordinates.data(), Dim, static_cast<Eigen::Index>(_vertices.size())};
+  }
+
   /// Creates and initializes a Vertex object.
   Vertex &createVertex(const Eigen::VectorXd &coords);
 
+  /**
+   * @brief Reserves memory for additional vertices and edges.
+   *
+   * Avoids reallocations of the coordinates and the edge index, when a known number of elements is created.
+   */
+  void reserve(size_t additionalVertices, size_t additionalEdges);
+
   /**
    * @brief Creates and initializes an Edge object.
    *
@@ -109,6 +139,8 @@ public:
   /**
    * @brief Creates and initializes an Edge object or returns an already existing one.
    *
+   * Existing edges are looked up in constant time using the edge index of the mesh.
+   *
    * @param[in] vertexOne Reference to first Vertex defining the Edge.
    * @param[in] vertexTwo Reference to second Vertex defining the Edge.
    */
@@ -234,6 +266,18 @@ public:
   bool operator!=(const Mesh &other) const;
 
 private:
+  /// Vertices copy their coordinates into the contiguous coordinates, if they are moved.
+  friend class Vertex;
+
+  /// Copies the coordinates of the given vertex of this mesh into the contiguous coordinates.
+  void updateVertexCoordinates(const Vertex &vertex);
+
+  /// Key of an edge in the edge index, the pair of its sorted vertex IDs
+  using EdgeKey = std::pair<VertexID, VertexID>;
+
+  /// Returns the key of the edge formed by the given vertices, independent of their order
+  static EdgeKey edgeKey(const Vertex &vertexOne, const Vertex &vertexTwo);
+
   mutable logging::Logger _log{"mesh::Mesh"};
 
   /// Name of the mesh.
@@ -250,6 +294,15 @@ private:
   EdgeContainer     _edges;
   TriangleContainer _triangles;
 
+  /// Coordinates of all vertices, stored contiguously vertex by vertex.
+  std::vector<double> _vertexCoordinates;
+
+  /// Revision of the vertices, see getVertexRevision()
+  std::size_t _vertexRevision = 0;
+
+  /// Maps the sorted vertex IDs of every edge to the ID of the first edge connecting them.
+  std::unordered_map<EdgeKey, EdgeID, boost::hash<EdgeKey>> _edgeIndex;
+
   /// Data hold by the vertices of the mesh.
   DataContainer _data;
 
@@ -1,10 +1,21 @@
 #include "Vertex.hpp"
 #include <Eigen/Core>
+#include "mesh/Mesh.hpp"
 #include "utils/EigenIO.hpp"
 
 namespace precice {
 namespace mesh {
 
+Vertex::Vertex(const Vertex &other)
+    : _coords(other._coords),
+      _dim(other._dim),
+      _id(other._id),
+      _globalIndex(other._globalIndex),
+      _owner(other._owner),
+      _tagged(other._tagged)
+{
+}
+
 int Vertex::getDimensions() const
 {
   return _dim;
@@ -40,6 +51,12 @@ void Vertex::tag()
   _tagged = true;
 }
 
+void Vertex::updateMeshCoordinates()
+{
+  PRECICE_ASSERT(_mesh);
+  _mesh->updateVertexCoordinates(*this);
+}
+
 std::ostream &operator<<(std::ostream &os, Vertex const &v)
 {
   return os << "POINT (" << v.getCoords().transpose().format(utils::eigenio::wkt()) << ')';
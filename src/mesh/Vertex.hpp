@@ -4,6 +4,7 @@
 #include <array>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 #include "math/differences.hpp"
 #include "precice/types.hpp"
@@ -12,6 +13,8 @@
 namespace precice {
 namespace mesh {
 
+class Mesh;
+
 /// Vertex of a mesh.
 class Vertex {
 public:
@@ -24,6 +27,12 @@ public:
       const VECTOR_T &coordinates,
       VertexID        id);
 
+  /// Copies the vertex, the copy does not belong to the mesh of the vertex.
+  Vertex(const Vertex &other);
+
+  /// Assigning would either detach a mesh vertex from its mesh or attach a vertex to a foreign mesh.
+  Vertex &operator=(const Vertex &) = delete;
+
   /// Returns spatial dimensionality of vertex.
   int getDimensions() const;
 
@@ -58,9 +67,18 @@ public:
   inline bool operator!=(const Vertex &rhs) const;
 
 private:
+  /// The owning mesh keeps a contiguous copy of the coordinates of its vertices.
+  friend class Mesh;
+
+  /// Updates the coordinates of the vertex in the owning mesh.
+  void updateMeshCoordinates();
+
   /// Coordinates of the vertex
   std::array<double, 3> _coords;
 
+  /// Mesh owning the vertex, which holds the coordinates at the ID of the vertex. Null if the vertex has no mesh.
+  Mesh *_mesh = nullptr;
+
   /// Dimension of the coordinates. 3D or 2D
   short _dim;
 
@@ -100,6 +118,9 @@ void Vertex::setCoords(
   _coords[0] = coordinates[0];
   _coords[1] = coordinates[1];
   _coords[2] = (_dim == 3) ? coordinates[2] : 0.0;
+  if (_mesh) {
+    updateMeshCoordinates();
+  }
 }
 
 inline VertexID Vertex::getID() const
@@ -285,6 +285,73 @@ BOOST_AUTO_TEST_CASE(CreateUniqueEdge)
   BOOST_TEST(mesh.edges().size() == 3);
 }
 
+BOOST_AUTO_TEST_CASE(CreateUniqueEdgeAfterModification)
+{
+  PRECICE_TEST(1_rank);
+  Mesh    mesh("Mesh", 3, testing::nextMeshID());
+  Vertex &v0 = mesh.createVertex(Vector3d(0.0, 0.0, 0.0));
+  Vertex &v1 = mesh.createVertex(Vector3d(1.0, 0.0, 0.0));
+  mesh.createEdge(v0, v1);
+  BOOST_TEST(mesh.createUniqueEdge(v1, v0).getID() == 0);
+
+  // Edges are forgotten after clearing the mesh
+  mesh.clear();
+  Vertex &w0 = mesh.createVertex(Vector3d(0.0, 0.0, 0.0));
+  Vertex &w1 = mesh.createVertex(Vector3d(0.0, 1.0, 0.0));
+  Vertex &w2 = mesh.createVertex(Vector3d(0.0, 0.0, 1.0));
+  BOOST_TEST(mesh.edges().empty());
+  mesh.createUniqueEdge(w0, w1);
+  BOOST_TEST(mesh.edges().size() == 1);
+
+  // Edges added via addMesh are known to createUniqueEdge
+  Mesh    delta("Delta", 3, testing::nextMeshID());
+  Vertex &d0 = delta.createVertex(Vector3d(1.0, 1.0, 0.0));
+  Vertex &d1 = delta.createVertex(Vector3d(1.0, 0.0, 1.0));
+  delta.createEdge(d0, d1);
+  mesh.addMesh(delta);
+  BOOST_TEST(mesh.vertices().size() == 5);
+  BOOST_TEST(mesh.edges().size() == 2);
+  BOOST_TEST(mesh.createUniqueEdge(mesh.vertices()[4], mesh.vertices()[3]).getID() == 1);
+  BOOST_TEST(mesh.edges().size() == 2);
+  mesh.createUniqueEdge(w2, w0);
+  BOOST_TEST(mesh.edges().size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(VertexCoordinates)
+{
+  PRECICE_TEST(1_rank);
+  Mesh    mesh("Mesh", 2, testing::nextMeshID());
+  Vertex &v0 = mesh.createVertex(Vector2d(0.0, 1.0));
+  mesh.createVertex(Vector2d(2.0, 3.0));
+  mesh.createVertex(Vector2d(4.0, 5.0));
+
+  Eigen::Matrix<double, 2, 3> expected;
+  expected << 0.0, 2.0, 4.0,
+      1.0, 3.0, 5.0;
+  BOOST_TEST(equals(mesh.vertexCoordinates(), expected));
+  BOOST_TEST(equals(mesh.vertexCoordinates<2>(), expected));
+
+  // Changing the vertex updates the coordinates and the vertex revision of the mesh
+  const auto revision = mesh.getVertexRevision();
+  v0.setCoords(Vector2d(6.0, 7.0));
+  expected.col(0) = Vector2d(6.0, 7.0);
+  BOOST_TEST(equals(mesh.vertexCoordinates(), expected));
+  BOOST_TEST(mesh.getVertexRevision() != revision);
+
+  // A copy of a vertex does not belong to the mesh, changing it leaves the mesh unchanged
+  Vertex copy(v0);
+  const auto copyRevision = mesh.getVertexRevision();
+  copy.setCoords(Vector2d(10.0, 11.0));
+  BOOST_TEST(equals(mesh.vertexCoordinates(), expected));
+  BOOST_TEST(mesh.getVertexRevision() == copyRevision);
+  BOOST_TEST(equals(v0.getCoords(), Vector2d(6.0, 7.0)));
+
+  mesh.clear();
+  BOOST_TEST(mesh.vertexCoordinates().cols() == 0);
+  mesh.createVertex(Vector2d(8.0, 9.0));
+  BOOST_TEST(equals(mesh.vertexCoordinates(), Vector2d(8.0, 9.0)));
+}
+
 BOOST_AUTO_TEST_CASE(ResizeDataGrow)
 {
   PRECICE_TEST(1_rank);
@@ -5,19 +5,26 @@
 #include <ostream>
 #include <utility>
 #include <vector>
+#include <boost/container/flat_map.hpp>
+#include <boost/function_output_iterator.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include "com/CommunicateBoundingBox.hpp"
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
 #include "m2n/M2N.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mesh/BoundingBox.hpp"
+#include "mesh/Edge.hpp"
 #include "mesh/Filter.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "partition/Partition.hpp"
+#include "query/impl/RTreeAdapter.hpp"
 #include "utils/Event.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
@@ -276,6 +283,115 @@ auto errorMeshFilteredOut(const std::string &meshName, const int rank)
                      "\"<use-mesh mesh=\"{0}\" ... geometric-filter=\"no-filter\" />",
                      meshName, rank);
 }
+
+/// Ids of the vertices, edges and triangles of a mesh per rank
+struct MeshBins {
+  std::vector<std::vector<VertexID>>   vertices;
+  std::vector<std::vector<EdgeID>>     edges;
+  std::vector<std::vector<TriangleID>> triangles;
+};
+
+/**
+ * @brief Assigns the mesh to all ranks, whose bounding box contains the respective vertices.
+ *
+ * The bounding boxes are indexed by an rtree, which is queried once per vertex. An edge belongs to all ranks
+ * containing both of its vertices and a triangle to all ranks containing its three edges, as for mesh::filterMesh().
+ * The mesh is traversed once, instead of once per rank.
+ */
+MeshBins binMesh(const mesh::Mesh &mesh, const std::vector<mesh::BoundingBox> &boxes)
+{
+  namespace bgi  = boost::geometry::index;
+  using RankBox  = std::pair<query::RTreeBox, Rank>;
+  using RankList = std::vector<Rank>;
+
+  std::vector<RankBox> rankBoxes;
+  for (Rank rank = 0; rank < static_cast<Rank>(boxes.size()); ++rank) {
+    if (not boxes[rank].empty()) {
+      rankBoxes.emplace_back(query::makeBox(boxes[rank].minCorner(), boxes[rank].maxCorner()), rank);
+    }
+  }
+  const bgi::rtree<RankBox, query::impl::RTreeParameters> tree(rankBoxes, query::impl::RTreeParameters(query::impl::DEFAULT_RTREE_NODE_CAPACITY));
+
+  MeshBins bins;
+  bins.vertices.resize(boxes.size());
+  bins.edges.resize(boxes.size());
+  bins.triangles.resize(boxes.size());
+
+  // The rank lists are sorted, such that they can be intersected for edges and triangles
+  std::vector<RankList> vertexRanks(mesh.vertices().size());
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    RankList &ranks = vertexRanks[vertex.getID()];
+    tree.query(bgi::intersects(vertex.rawCoords()),
+               boost::make_function_output_iterator([&ranks](const RankBox &rankBox) { ranks.push_back(rankBox.second); }));
+    std::sort(ranks.begin(), ranks.end());
+    for (Rank rank : ranks) {
+      bins.vertices[rank].push_back(vertex.getID());
+    }
+  }
+
+  std::vector<RankList> edgeRanks(mesh.edges().size());
+  for (const mesh::Edge &edge : mesh.edges()) {
+    const RankList &ranks1 = vertexRanks[edge.vertex(0).getID()];
+    const RankList &ranks2 = vertexRanks[edge.vertex(1).getID()];
+    RankList &      ranks  = edgeRanks[edge.getID()];
+    std::set_intersection(ranks1.begin(), ranks1.end(), ranks2.begin(), ranks2.end(), std::back_inserter(ranks));
+    for (Rank rank : ranks) {
+      bins.edges[rank].push_back(edge.getID());
+    }
+  }
+
+  if (mesh.getDimensions() == 3) {
+    RankList partial;
+    RankList ranks;
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      const RankList &ranks1 = edgeRanks[triangle.edge(0).getID()];
+      const RankList &ranks2 = edgeRanks[triangle.edge(1).getID()];
+      const RankList &ranks3 = edgeRanks[triangle.edge(2).getID()];
+      partial.clear();
+      ranks.clear();
+      std::set_intersection(ranks1.begin(), ranks1.end(), ranks2.begin(), ranks2.end(), std::back_inserter(partial));
+      std::set_intersection(partial.begin(), partial.end(), ranks3.begin(), ranks3.end(), std::back_inserter(ranks));
+      for (Rank rank : ranks) {
+        bins.triangles[rank].push_back(triangle.getID());
+      }
+    }
+  }
+  return bins;
+}
+
+/// Copies the part of the source mesh binned to the given rank to the destination, see binMesh()
+void copyBin(mesh::Mesh &destination, const mesh::Mesh &source, const MeshBins &bins, Rank rank)
+{
+  const auto &vertexIDs = bins.vertices[rank];
+  const auto &edgeIDs   = bins.edges[rank];
+  destination.reserve(vertexIDs.size(), edgeIDs.size());
+
+  // The ids are sorted, hence the maps are filled at their end
+  boost::container::flat_map<VertexID, mesh::Vertex *> vertexMap;
+  vertexMap.reserve(vertexIDs.size());
+  for (VertexID id : vertexIDs) {
+    const mesh::Vertex &vertex = source.vertices()[id];
+    mesh::Vertex &      v      = destination.createVertex(vertex.getCoords());
+    v.setGlobalIndex(vertex.getGlobalIndex());
+    if (vertex.isTagged())
+      v.tag();
+    v.setOwner(vertex.isOwner());
+    vertexMap.emplace_hint(vertexMap.end(), id, &v);
+  }
+
+  boost::container::flat_map<EdgeID, mesh::Edge *> edgeMap;
+  edgeMap.reserve(edgeIDs.size());
+  for (EdgeID id : edgeIDs) {
+    const mesh::Edge &edge = source.edges()[id];
+    mesh::Edge &      e    = destination.createEdge(*vertexMap.at(edge.vertex(0).getID()), *vertexMap.at(edge.vertex(1).getID()));
+    edgeMap.emplace_hint(edgeMap.end(), id, &e);
+  }
+
+  for (TriangleID id : bins.triangles[rank]) {
+    const mesh::Triangle &triangle = source.triangles()[id];
+    destination.createTriangle(*edgeMap.at(triangle.edge(0).getID()), *edgeMap.at(triangle.edge(1).getID()), *edgeMap.at(triangle.edge(2).getID()));
+  }
+}
 } // namespace
 
 void ReceivedPartition::filterByBoundingBox()
@@ -312,26 +428,34 @@ void ReceivedPartition::filterByBoundingBox()
       PRECICE_ASSERT(utils::MasterSlave::getRank() == 0);
       PRECICE_ASSERT(utils::MasterSlave::getSize() > 1);
 
+      // Gather all bounding boxes first, such that the mesh is binned in a single pass
+      std::vector<mesh::BoundingBox> boxes(utils::MasterSlave::getSize(), mesh::BoundingBox(_dimensions));
+      boxes[0] = _bb;
       for (int rankSlave : utils::MasterSlave::allSlaves()) {
-        mesh::BoundingBox slaveBB(_bb.getDimension());
-        com::CommunicateBoundingBox(utils::MasterSlave::_communication).receiveBoundingBox(slaveBB, rankSlave);
+        com::CommunicateBoundingBox(utils::MasterSlave::_communication).receiveBoundingBox(boxes[rankSlave], rankSlave);
+        PRECICE_DEBUG("From slave {}, bounding mesh: {}", rankSlave, boxes[rankSlave]);
+      }
+      const MeshBins bins = binMesh(*_mesh, boxes);
 
-        PRECICE_DEBUG("From slave {}, bounding mesh: {}", rankSlave, slaveBB);
+      // The filtered mesh of a slave is sent while the mesh of the next slave is assembled
+      std::vector<com::PtrRequest> requests;
+      for (int rankSlave : utils::MasterSlave::allSlaves()) {
         mesh::Mesh slaveMesh("SlaveMesh", _dimensions, mesh::Mesh::MESH_ID_UNDEFINED);
-        mesh::filterMesh(slaveMesh, *_mesh, [&slaveBB](const mesh::Vertex &v) { return slaveBB.contains(v); });
+        copyBin(slaveMesh, *_mesh, bins, rankSlave);
         PRECICE_DEBUG("Send filtered mesh to slave: {}", rankSlave);
-        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(slaveMesh, rankSlave);
+        requests.push_back(com::CommunicateMesh(utils::MasterSlave::_communication).aSendMesh(slaveMesh, rankSlave));
       }
 
       // Now also filter the remaining master mesh
       mesh::Mesh filteredMesh("FilteredMesh", _dimensions, mesh::Mesh::MESH_ID_UNDEFINED);
-      mesh::filterMesh(filteredMesh, *_mesh, [&](const mesh::Vertex &v) { return _bb.contains(v); });
+      copyBin(filteredMesh, *_mesh, bins, 0);
       PRECICE_DEBUG("Master mesh, filtered from {} to {} vertices, {} to {} edges, and {} to {} triangles.",
                     _mesh->vertices().size(), filteredMesh.vertices().size(),
                     _mesh->edges().size(), filteredMesh.edges().size(),
                     _mesh->triangles().size(), filteredMesh.triangles().size());
       _mesh->clear();
       _mesh->addMesh(filteredMesh);
+      com::Request::wait(requests);
 
       if (isAnyProvidedMeshNonEmpty()) {
         PRECICE_CHECK(not _mesh->vertices().empty(), errorMeshFilteredOut(_mesh->getName(), utils::MasterSlave::getRank()));
@@ -293,6 +293,70 @@ BOOST_AUTO_TEST_CASE(RePartitionNNBroadcastFilter2D)
   tearDownParallelEnvironment();
 }
 
+BOOST_AUTO_TEST_CASE(RePartitionOnMasterOverlappingBoxes2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  auto m2n = context.connectMasters("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) {
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    createSolidzMesh2D(pSolidzMesh);
+    ProvidedPartition part(pSolidzMesh);
+    part.addM2N(m2n);
+    part.communicate();
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+
+    // The bounding boxes of master and slave 2 coincide, the one of slave 1 overlaps both
+    Eigen::VectorXd position(dimensions);
+    if (context.isRank(1)) {
+      position << 0.0, 4.0;
+      pNastinMesh->createVertex(position);
+      position << 0.0, 6.0;
+      pNastinMesh->createVertex(position);
+    } else {
+      position << 0.0, 0.0;
+      pNastinMesh->createVertex(position);
+      position << 0.0, 4.5;
+      pNastinMesh->createVertex(position);
+    }
+    pNastinMesh->computeBoundingBox();
+
+    // Direct access keeps all vertices within the bounding box
+    double            safetyFactor = 0.1;
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::ON_MASTER, safetyFactor, true);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    BOOST_TEST_CONTEXT(*pSolidzMesh)
+    {
+      std::vector<int> globalIndices;
+      for (const auto &vertex : pSolidzMesh->vertices()) {
+        globalIndices.push_back(vertex.getGlobalIndex());
+      }
+      if (context.isRank(1)) {
+        BOOST_TEST(globalIndices == (std::vector<int>{3, 4, 5}));
+        BOOST_TEST(pSolidzMesh->edges().size() == 2);
+      } else {
+        BOOST_TEST(globalIndices == (std::vector<int>{0, 1, 2, 3}));
+        BOOST_TEST(pSolidzMesh->edges().size() == 3);
+      }
+    }
+  }
+
+  tearDownParallelEnvironment();
+}
+
 BOOST_AUTO_TEST_CASE(RePartitionNNDoubleNode2D)
 {
   PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
@@ -47,6 +47,18 @@ void SolverInterface::finalize()
   return _impl->finalize();
 }
 
+void SolverInterface::writeCheckpoint(
+    const std::string &filenamePrefix)
+{
+  _impl->writeCheckpoint(filenamePrefix);
+}
+
+void SolverInterface::readCheckpoint(
+    const std::string &filenamePrefix)
+{
+  _impl->readCheckpoint(filenamePrefix);
+}
+
 int SolverInterface::getDimensions() const
 {
   return _impl->getDimensions();
@@ -202,6 +214,14 @@ void SolverInterface::setMeshTriangleWithEdges(
   _impl->setMeshTriangleWithEdges(meshID, firstVertexID, secondVertexID, thirdVertexID);
 }
 
+void SolverInterface::setMeshTriangles(
+    int        meshID,
+    int        size,
+    const int *vertexIDs)
+{
+  _impl->setMeshTriangles(meshID, size, vertexIDs);
+}
+
 void SolverInterface::setMeshQuad(
     int meshID,
     int firstEdgeID,
@@ -156,6 +156,42 @@ public:
    */
   void finalize();
 
+  /**
+   * @brief Writes the coupling state required for a warm restart.
+   *
+   * @param[in] filenamePrefix Prefix of the binary files to be written.
+   *
+   * Every rank writes the coupling data, the extrapolation samples and the state
+   * of the acceleration, e.g., the quasi-Newton matrices and the preconditioner
+   * weights, to its own file. The file name consists of the prefix, the
+   * participant name and the rank. The files use the native byte order.
+   *
+   * @pre initialize() has been called successfully.
+   * @pre isTimeWindowComplete() returns true.
+   * @pre finalize() has not yet been called.
+   *
+   * @see readCheckpoint()
+   */
+  void writeCheckpoint(const std::string &filenamePrefix);
+
+  /**
+   * @brief Restores the coupling state written by writeCheckpoint().
+   *
+   * @param[in] filenamePrefix Prefix of the binary files written by writeCheckpoint().
+   *
+   * The restarted run continues with the same quasi-Newton updates as an
+   * uninterrupted run. All coupled participants have to restore their state.
+   * The solver is responsible for restoring its own state, including the time.
+   *
+   * @pre initialize() and, if required, initializeData() have been called successfully.
+   * @pre advance() has not yet been called.
+   * @pre The partitions of the meshes equal the ones of the run that wrote the checkpoint.
+   *
+   * @post Coupling data values, time and time window are restored.
+   * @post Read data is mapped to the meshes of the solver.
+   */
+  void readCheckpoint(const std::string &filenamePrefix);
+
   ///@}
 
   ///@name Status Queries
@@ -442,7 +478,7 @@ public:
    * @param[in] positions Positions to find ids for.
    *            The 2D-format is (d0x, d0y, d1x, d1y, ..., dnx, dny)
    *            The 3D-format is (d0x, d0y, d0z, d1x, d1y, d1z, ..., dnx, dny, dnz)
-   * @param[out] ids IDs corresponding to positions.
+   * @param[out] ids IDs corresponding to positions. If several vertices share a position, the lowest of their IDs.
    *
    * @pre count of available elements at positions matches the configured dimension * size
    * @pre count of available elements at ids matches size
@@ -509,6 +545,25 @@ public:
       int secondVertexID,
       int thirdVertexID);
 
+  /**
+   * @brief Sets multiple mesh triangles from vertex IDs.
+   *
+   * Edges are created on the fly within preCICE. In contrast to repeated calls of
+   * setMeshTriangleWithEdges(), all triangles and their edges are created in a single pass.
+   *
+   * @param[in] meshID ID of the mesh to add the triangles to
+   * @param[in] size Number of triangles to create
+   * @param[in] vertexIDs IDs of the vertices forming the triangles
+   *            The format is (t0v0, t0v1, t0v2, t1v0, t1v1, t1v2, ..., tnv0, tnv1, tnv2)
+   *
+   * @pre vertices with the given vertexIDs were added to the mesh with the ID meshID
+   * @pre count of available elements at vertexIDs matches 3 * size
+   */
+  void setMeshTriangles(
+      int        meshID,
+      int        size,
+      const int *vertexIDs);
+
   /**
    * @brief Sets mesh Quad from edge IDs.
    *
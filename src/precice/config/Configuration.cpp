@@ -1,5 +1,7 @@
 #include "Configuration.hpp"
 #include "logging/LogMacros.hpp"
+#include "query/impl/Indexer.hpp"
+#include "utils/Threading.hpp"
 #include "xml/XMLAttribute.hpp"
 
 namespace precice {
@@ -25,6 +27,18 @@ Configuration::Configuration()
   auto attrSyncMode = xml::makeXMLAttribute("sync-mode", false)
                           .setDocumentation("sync-mode enabled additional inter- and intra-participant synchronizations");
   _tag.addAttribute(attrSyncMode);
+
+  auto attrThreads = xml::makeXMLAttribute("threads", 1)
+                         .setDocumentation("Number of threads each rank uses for thread-parallel loops, such as the nearest-neighbor search of mappings.");
+  _tag.addAttribute(attrThreads);
+
+  auto attrPersistentIndex = xml::makeXMLAttribute("persistent-index-cache", false)
+                                 .setDocumentation("Keeps the spatial index trees of meshes over mapping re-computations and updates them incrementally when vertices move, instead of rebuilding them from scratch.");
+  _tag.addAttribute(attrPersistentIndex);
+
+  auto attrRebuildFraction = xml::makeXMLAttribute("index-rebuild-fraction", 0.1)
+                                 .setDocumentation("Fraction of changed vertices of a mesh above which its persistent index tree is rebuilt from scratch instead of updated incrementally.");
+  _tag.addAttribute(attrRebuildFraction);
 }
 
 xml::XMLTag &Configuration::getXMLTag()
@@ -37,6 +51,19 @@ void Configuration::xmlTagCallback(const xml::ConfigurationContext &context, xml
   PRECICE_TRACE(tag.getName());
   if (tag.getName() == "precice-configuration") {
     precice::syncMode = tag.getBooleanAttributeValue("sync-mode");
+    const int threads = tag.getIntAttributeValue("threads");
+    PRECICE_CHECK(threads > 0,
+                  "Attribute \"threads\" of tag <precice-configuration> has to be a positive number, but is {}. "
+                  "Please correct the number of threads in the configuration.",
+                  threads);
+    utils::Threading::setNumberOfThreads(threads);
+
+    const double rebuildFraction = tag.getDoubleAttributeValue("index-rebuild-fraction");
+    PRECICE_CHECK(rebuildFraction >= 0.0 && rebuildFraction <= 1.0,
+                  "Attribute \"index-rebuild-fraction\" of tag <precice-configuration> has to be between 0 and 1, but is {}. "
+                  "Please correct the fraction in the configuration.",
+                  rebuildFraction);
+    query::impl::Indexer::instance()->setPersistentCache(tag.getBooleanAttributeValue("persistent-index-cache"), rebuildFraction);
   }
 }
 
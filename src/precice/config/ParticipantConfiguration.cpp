@@ -213,6 +213,12 @@ ParticipantConfiguration::ParticipantConfiguration(
                                "for the InfiniBand on SuperMUC. ");
     tagMaster.addAttribute(attrNetwork);
 
+    auto attrNoDelay = makeXMLAttribute(ATTR_NO_DELAY, false)
+                           .setDocumentation(
+                               "Disables Nagle's algorithm (TCP_NODELAY), such that small messages are sent immediately "
+                               "instead of being delayed to be combined with subsequent ones.");
+    tagMaster.addAttribute(attrNoDelay);
+
     auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
                                      .setDocumentation(
                                          "Directory where connection information is exchanged. By default, the "
@@ -236,6 +242,21 @@ ParticipantConfiguration::ParticipantConfiguration(
 
     masterTags.push_back(tagMaster);
   }
+  {
+    XMLTag tagMaster(*this, "shm", masterOcc, TAG_MASTER);
+    doc = "A solver in parallel needs a communication between its ranks. ";
+    doc += "By default, the participant's MPI_COM_WORLD is reused.";
+    doc += "Use this tag to use POSIX shared memory instead, which requires all ranks to run on the same node.";
+    tagMaster.setDocumentation(doc);
+
+    auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
+                                     .setDocumentation(
+                                         "Directory where connection information is exchanged. By default, the "
+                                         "directory of startup is chosen.");
+    tagMaster.addAttribute(attrExchangeDirectory);
+
+    masterTags.push_back(tagMaster);
+  }
   {
     XMLTag tagMaster(*this, "mpi-single", masterOcc, TAG_MASTER);
     doc = "A solver in parallel needs a communication between its ranks. ";
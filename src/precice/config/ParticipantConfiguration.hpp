@@ -91,6 +91,7 @@ private:
   const std::string ATTR_CONTEXT            = "context";
   const std::string ATTR_NETWORK            = "network";
   const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
+  const std::string ATTR_NO_DELAY           = "no-delay";
   const std::string ATTR_SCALE_WITH_CONN    = "scale-with-connectivity";
 
   const std::string VALUE_FILTER_ON_SLAVES = "on-slaves";
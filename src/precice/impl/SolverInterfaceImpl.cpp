@@ -8,6 +8,7 @@
 #include <memory>
 #include <ostream>
 #include <sstream>
+#include <string>
 #include <tuple>
 #include <utility>
 
@@ -31,6 +32,7 @@
 #include "mapping/config/MappingConfiguration.hpp"
 #include "math/differences.hpp"
 #include "math/geometry.hpp"
+#include "mesh/BoundingBox.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
@@ -57,6 +59,7 @@
 #include "precice/impl/WriteDataContext.hpp"
 #include "precice/impl/versions.hpp"
 #include "precice/types.hpp"
+#include "query/Index.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/EigenIO.hpp"
 #include "utils/Event.hpp"
@@ -414,7 +417,8 @@ double SolverInterfaceImpl::advance(
 
   if (_couplingScheme->willDataBeExchanged(0.0)) {
     performDataActions({action::Action::WRITE_MAPPING_PRIOR}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
-    mapWrittenData();
+    // Actions after the write mapping may still modify the mapped data
+    mapWrittenData(not hasDataActions(action::Action::WRITE_MAPPING_POST));
     performDataActions({action::Action::WRITE_MAPPING_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
   }
 
@@ -422,6 +426,9 @@ double SolverInterfaceImpl::advance(
   _couplingScheme->advance();
 
   if (_couplingScheme->hasDataBeenReceived()) {
+    if (hasDataActions(action::Action::READ_MAPPING_PRIOR)) {
+      _couplingScheme->waitForReceivedData();
+    }
     performDataActions({action::Action::READ_MAPPING_PRIOR}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
     mapReadData();
     performDataActions({action::Action::READ_MAPPING_POST}, time, computedTimestepLength, timeWindowComputedPart, timeWindowSize);
@@ -503,6 +510,39 @@ void SolverInterfaceImpl::finalize()
   _state = State::Finalized;
 }
 
+void SolverInterfaceImpl::writeCheckpoint(
+    const std::string &filenamePrefix)
+{
+  PRECICE_TRACE(filenamePrefix);
+  PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before writeCheckpoint().");
+  PRECICE_CHECK(_state != State::Finalized, "writeCheckpoint() cannot be called after finalize().");
+  PRECICE_CHECK(_couplingScheme->isTimeWindowComplete(),
+                "writeCheckpoint() can only be called at the end of a completed time window. "
+                "Please call writeCheckpoint() only if isTimeWindowComplete() returns true.");
+  Event e("writeCheckpoint", precice::syncMode);
+  _couplingScheme->exportState(checkpointFilename(filenamePrefix));
+}
+
+void SolverInterfaceImpl::readCheckpoint(
+    const std::string &filenamePrefix)
+{
+  PRECICE_TRACE(filenamePrefix);
+  PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before readCheckpoint().");
+  PRECICE_CHECK(_state != State::Finalized, "readCheckpoint() cannot be called after finalize().");
+  PRECICE_CHECK(_numberAdvanceCalls == 0, "readCheckpoint() has to be called before the first call of advance().");
+  Event e("readCheckpoint", precice::syncMode);
+  _couplingScheme->importState(checkpointFilename(filenamePrefix));
+
+  // The restored values of the coupling meshes replace the ones received in initialize()
+  double time = _couplingScheme->getTime();
+  double dt   = _couplingScheme->getNextTimestepMaxLength();
+  performDataActions({action::Action::READ_MAPPING_PRIOR}, time, 0.0, 0.0, dt);
+  mapReadData();
+  performDataActions({action::Action::READ_MAPPING_POST}, time, 0.0, 0.0, dt);
+
+  PRECICE_INFO("Restored checkpoint \"{}\". {}", filenamePrefix, _couplingScheme->printCouplingState());
+}
+
 int SolverInterfaceImpl::getDimensions() const
 {
   PRECICE_TRACE(_dimensions);
@@ -739,25 +779,39 @@ void SolverInterfaceImpl::getMeshVertexIDsFromPositions(
   const auto &                      vertices = mesh->vertices();
   Eigen::Map<const Eigen::MatrixXd> posMatrix{
       positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
-  const auto vsize = vertices.size();
+
+  // The vertex index tree is cached per mesh and updated lazily once the vertices changed.
+  // Hence, it is built once for all queries instead of comparing every position against every vertex.
+  query::Index index(mesh);
   for (size_t i = 0; i < size; i++) {
-    size_t j = 0;
-    for (; j < vsize; j++) {
-      if (math::equals(posMatrix.col(i), vertices[j].getCoords())) {
-        break;
-      }
+    const Eigen::VectorXd position = posMatrix.col(i);
+    // All vertices equal to the position lie inside this box, duplicates resolve to the lowest ID
+    const double        radius = math::NUMERICAL_ZERO_DIFFERENCE * position.norm();
+    std::vector<double> bounds;
+    for (int d = 0; d < _dimensions; ++d) {
+      bounds.push_back(position[d] - radius);
+      bounds.push_back(position[d] + radius);
     }
-    if (j == vsize) {
-      std::ostringstream err;
-      err << "Unable to find a vertex on mesh \"" << mesh->getName() << "\" at position (";
-      err << posMatrix.col(i)[0] << ", " << posMatrix.col(i)[1];
-      if (_dimensions == 3) {
-        err << ", " << posMatrix.col(i)[2];
+    int id = -1;
+    if (not vertices.empty()) {
+      for (VertexID candidate : index.getVerticesInsideBox(mesh::BoundingBox(std::move(bounds)))) {
+        if ((id == -1 || candidate < id) && math::equals(position, vertices[candidate].getCoords())) {
+          id = candidate;
+        }
       }
-      err << "). The request failed for query " << i + 1 << " out of " << size << '.';
-      PRECICE_ERROR(err.str());
     }
-    ids[i] = j;
+    if (id != -1) {
+      ids[i] = id;
+      continue;
+    }
+    std::ostringstream err;
+    err << "Unable to find a vertex on mesh \"" << mesh->getName() << "\" at position (";
+    err << position[0] << ", " << position[1];
+    if (_dimensions == 3) {
+      err << ", " << position[2];
+    }
+    err << "). The request failed for query " << i + 1 << " out of " << size << '.';
+    PRECICE_ERROR(err.str());
   }
 }
 
@@ -850,6 +904,45 @@ void SolverInterfaceImpl::setMeshTriangleWithEdges(
   }
 }
 
+void SolverInterfaceImpl::setMeshTriangles(
+    MeshID     meshID,
+    int        size,
+    const int *vertexIDs)
+{
+  PRECICE_TRACE(meshID, size);
+  PRECICE_CHECK(_dimensions == 3, "setMeshTriangles is only possible for 3D cases."
+                                  " Please set the dimension to 3 in the preCICE configuration file.");
+  PRECICE_REQUIRE_MESH_MODIFY(meshID);
+  MeshContext &context = _accessor->usedMeshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL) {
+    mesh::PtrMesh &mesh = context.mesh;
+    using impl::errorInvalidVertexID;
+    for (int i = 0; i < size * 3; ++i) {
+      PRECICE_CHECK(mesh->isValidVertexID(vertexIDs[i]), errorInvalidVertexID(vertexIDs[i]));
+    }
+
+    // All edges are created within the same pass as the triangles.
+    // Existing edges are looked up via the edge index of the mesh.
+    for (int i = 0; i < size; ++i) {
+      const int *ids = &vertexIDs[i * 3];
+      PRECICE_CHECK(utils::unique_elements(utils::make_array(ids[0], ids[1], ids[2])),
+                    "setMeshTriangles() was called with repeated Vertex IDs ({}, {}, {}) for triangle {}.",
+                    ids[0], ids[1], ids[2], i);
+      mesh::Vertex &v0 = mesh->vertices()[ids[0]];
+      mesh::Vertex &v1 = mesh->vertices()[ids[1]];
+      mesh::Vertex &v2 = mesh->vertices()[ids[2]];
+      PRECICE_CHECK(utils::unique_elements(utils::make_array(v0.rawCoords(), v1.rawCoords(), v2.rawCoords())),
+                    "setMeshTriangles() was called with vertices located at identical coordinates (IDs: {}, {}, {}) for triangle {}.",
+                    ids[0], ids[1], ids[2], i);
+
+      mesh::Edge &e0 = mesh->createUniqueEdge(v0, v1);
+      mesh::Edge &e1 = mesh->createUniqueEdge(v1, v2);
+      mesh::Edge &e2 = mesh->createUniqueEdge(v2, v0);
+      mesh->createTriangle(e0, e1, e2);
+    }
+  }
+}
+
 void SolverInterfaceImpl::setMeshQuad(
     MeshID meshID,
     int    firstEdgeID,
@@ -1600,12 +1693,16 @@ void SolverInterfaceImpl::clearMappings(utils::ptr_vector<MappingContext> contex
   }
 }
 
-void SolverInterfaceImpl::mapWrittenData()
+void SolverInterfaceImpl::mapWrittenData(bool sendDataAhead)
 {
-  PRECICE_TRACE();
+  PRECICE_TRACE(sendDataAhead);
   computeMappings(_accessor->writeMappingContexts(), "write");
   for (auto &context : _accessor->writeDataContexts()) {
     mapData(context, "write");
+    if (sendDataAhead) {
+      // The exchange of this data overlaps with the mapping of the remaining data
+      _couplingScheme->sendDataAhead(context.hasMapping() ? context.getToDataID() : context.getProvidedDataID());
+    }
   }
   clearMappings(_accessor->writeMappingContexts());
 }
@@ -1615,11 +1712,20 @@ void SolverInterfaceImpl::mapReadData()
   PRECICE_TRACE();
   computeMappings(_accessor->readMappingContexts(), "read");
   for (auto &context : _accessor->readDataContexts()) {
+    _couplingScheme->waitForReceivedData(context.hasMapping() ? context.getFromDataID() : context.getProvidedDataID());
     mapData(context, "read");
   }
+  // Data might be accessed directly or mapped on demand
+  _couplingScheme->waitForReceivedData();
   clearMappings(_accessor->readMappingContexts());
 }
 
+bool SolverInterfaceImpl::hasDataActions(action::Action::Timing timing) const
+{
+  return std::any_of(_accessor->actions().begin(), _accessor->actions().end(),
+                     [timing](const action::PtrAction &action) { return action->getTiming() == timing; });
+}
+
 void SolverInterfaceImpl::performDataActions(
     const std::set<action::Action::Timing> &timings,
     double                                  time,
@@ -1635,6 +1741,11 @@ void SolverInterfaceImpl::performDataActions(
   }
 }
 
+std::string SolverInterfaceImpl::checkpointFilename(const std::string &filenamePrefix) const
+{
+  return filenamePrefix + "_" + _accessorName + "_" + std::to_string(_accessorProcessRank);
+}
+
 void SolverInterfaceImpl::handleExports()
 {
   PRECICE_TRACE();
@@ -166,6 +166,12 @@ public:
    */
   void finalize();
 
+  /// @copydoc SolverInterface::writeCheckpoint()
+  void writeCheckpoint(const std::string &filenamePrefix);
+
+  /// @copydoc SolverInterface::readCheckpoint()
+  void readCheckpoint(const std::string &filenamePrefix);
+
   /**
    * @brief Returns the number of spatial dimensions for the coupling.
    *
@@ -332,6 +338,12 @@ public:
       int    secondVertexID,
       int    thirdVertexID);
 
+  /// Sets multiple triangles and creates/sets edges automatically of a solver mesh.
+  void setMeshTriangles(
+      MeshID     meshID,
+      int        size,
+      const int *vertexIDs);
+
   /// Set a quadrangle of a solver mesh.
   void setMeshQuad(
       MeshID meshID,
@@ -609,6 +621,9 @@ private:
   /// Exports meshes with data and watch point data.
   void handleExports();
 
+  /// Returns the name of the checkpoint file of this rank, i.e., prefix_participant_rank.
+  std::string checkpointFilename(const std::string &filenamePrefix) const;
+
   /**
    * @brief Adds exchanged data ids related to accessor to the coupling scheme.
    *
@@ -657,12 +672,19 @@ private:
   /// Helper for mapWrittenData and mapReadData
   void clearMappings(utils::ptr_vector<MappingContext> contexts);
 
-  /// Computes, performs, and resets all suitable write mappings.
-  void mapWrittenData();
+  /**
+   * @brief Computes, performs, and resets all suitable write mappings.
+   *
+   * @param[in] sendDataAhead Whether the coupling scheme may send every data as soon as it is mapped.
+   */
+  void mapWrittenData(bool sendDataAhead = false);
 
-  /// Computes, performs, and resets all suitable read mappings.
+  /// Computes, performs, and resets all suitable read mappings, waits for the received data before.
   void mapReadData();
 
+  /// Returns true, if the participant has actions with the given timing.
+  bool hasDataActions(action::Action::Timing timing) const;
+
   /**
    * @brief Performs all data actions with given timing.
    *
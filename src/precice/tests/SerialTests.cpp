@@ -150,6 +150,40 @@ BOOST_AUTO_TEST_CASE(NP2D_B)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/// Looks up the IDs of vertices by their positions, also after further vertices were set
+BOOST_AUTO_TEST_CASE(GetMeshVertexIDsFromPositions)
+{
+  PRECICE_TEST(1_rank);
+  std::string     filename = _pathToTests + "meshrequirements-nn.xml";
+  SolverInterface interface("A", filename, 0, 1);
+  auto            meshID = interface.getMeshID("MeshA");
+
+  // Vertex 2 duplicates vertex 1, vertex 3 is at the origin
+  std::vector<double> positions{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 4.0, 5.0, 6.0, 0.0, 0.0, 0.0};
+  std::vector<int>    ids(4, -1);
+  interface.setMeshVertices(meshID, 4, positions.data(), ids.data());
+  BOOST_TEST(ids == std::vector<int>({0, 1, 2, 3}));
+
+  std::vector<double> queries{0.0, 0.0, 0.0, 4.0, 5.0, 6.0, 1.0, 2.0, 3.0};
+  std::vector<int>    foundIDs(3, -1);
+  interface.getMeshVertexIDsFromPositions(meshID, 3, queries.data(), foundIDs.data());
+  BOOST_TEST(foundIDs == std::vector<int>({3, 1, 0}));
+
+  // Vertices set after a lookup are found as well, duplicates still resolve to the lowest ID
+  std::vector<double> more{7.0, 8.0, 9.0, 1.0, 2.0, 3.0};
+  std::vector<int>    moreIDs(2, -1);
+  interface.setMeshVertices(meshID, 2, more.data(), moreIDs.data());
+  BOOST_TEST(moreIDs == std::vector<int>({4, 5}));
+  interface.getMeshVertexIDsFromPositions(meshID, 2, more.data(), foundIDs.data());
+  BOOST_TEST(foundIDs[0] == 4);
+  BOOST_TEST(foundIDs[1] == 0);
+
+  std::vector<double> position{0.5, 0.5, 0.5};
+  const int           singleID = interface.setMeshVertex(meshID, position.data());
+  interface.getMeshVertexIDsFromPositions(meshID, 1, position.data(), foundIDs.data());
+  BOOST_TEST(foundIDs[0] == singleID);
+}
+
 BOOST_AUTO_TEST_SUITE(Lifecycle)
 
 // Test representing the full explicit lifecycle of a SolverInterface
@@ -1849,7 +1883,7 @@ BOOST_AUTO_TEST_CASE(MultiCoupling)
   }
 }
 
-void testMappingNearestProjection(bool defineEdgesExplicitly, const std::string configFile, const TestContext &context)
+void testMappingNearestProjection(bool defineEdgesExplicitly, const std::string configFile, const TestContext &context, bool defineTrianglesInBulk = false)
 {
   using Eigen::Vector3d;
 
@@ -1897,6 +1931,9 @@ void testMappingNearestProjection(bool defineEdgesExplicitly, const std::string
       cplInterface.setMeshTriangle(meshOneID, idAB, idBC, idCA);
       cplInterface.setMeshTriangle(meshOneID, idCD, idDA, idCA);
 
+    } else if (defineTrianglesInBulk) {
+      std::vector<int> vertexIDs{idA, idB, idC, idC, idD, idA};
+      cplInterface.setMeshTriangles(meshOneID, 2, vertexIDs.data());
     } else {
       cplInterface.setMeshTriangleWithEdges(meshOneID, idA, idB, idC);
       cplInterface.setMeshTriangleWithEdges(meshOneID, idC, idD, idA);
@@ -1973,6 +2010,18 @@ BOOST_AUTO_TEST_CASE(MappingNearestProjectionImplicitEdges)
   testMappingNearestProjection(defineEdgesExplicitly, configFile, context);
 }
 
+/**
+ * @brief Tests the Nearest Projection Mapping between two participants with triangles defined in bulk
+ *
+ */
+BOOST_AUTO_TEST_CASE(MappingNearestProjectionBulkTriangles)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  bool              defineEdgesExplicitly = false;
+  const std::string configFile            = _pathToTests + "mapping-nearest-projection.xml";
+  testMappingNearestProjection(defineEdgesExplicitly, configFile, context, true);
+}
+
 /**
  * @brief Tests sending one mesh to multiple participants
  *
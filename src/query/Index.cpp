@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <boost/optional.hpp>
 #include <boost/range/irange.hpp>
 #include <utility>
 
@@ -8,6 +9,7 @@
 #include "logging/LogMacros.hpp"
 #include "precice/types.hpp"
 #include "utils/Event.hpp"
+#include "utils/Threading.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -30,14 +32,37 @@ Index::Index(mesh::PtrMesh mesh)
 
 Index::~Index() = default;
 
-VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
+void Index::loadVertexTree()
 {
-  PRECICE_TRACE();
   // Add tree to the local cache
   if (not _pimpl->indices.vertexRTree) {
     precice::utils::Event e("query.index.getVertexIndexTree." + _mesh->getName());
     _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
   }
+}
+
+void Index::loadEdgeTree()
+{
+  // Add tree to the local cache
+  if (not _pimpl->indices.edgeRTree) {
+    precice::utils::Event e("query.index.getEdgeIndexTree." + _mesh->getName());
+    _pimpl->indices.edgeRTree = impl::Indexer::instance()->getEdgeRTree(_mesh);
+  }
+}
+
+void Index::loadTriangleTree()
+{
+  // Add tree to the local cache
+  if (not _pimpl->indices.triangleRTree) {
+    precice::utils::Event e("query.index.getTriangleIndexTree." + _mesh->getName());
+    _pimpl->indices.triangleRTree = impl::Indexer::instance()->getTriangleRTree(_mesh);
+  }
+}
+
+VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
+{
+  PRECICE_TRACE();
+  loadVertexTree();
 
   PRECICE_ASSERT(not _mesh->vertices().empty(), _mesh->getName());
   VertexMatch match;
@@ -47,14 +72,41 @@ VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
   return match;
 }
 
+std::vector<VertexMatch> Index::getClosestVertices(const Eigen::Ref<const Eigen::MatrixXd> &locations)
+{
+  PRECICE_TRACE(locations.cols());
+  PRECICE_ASSERT(locations.rows() == _mesh->getDimensions(), locations.rows(), _mesh->getDimensions());
+  const std::size_t        size = locations.cols();
+  std::vector<VertexMatch> matches(size);
+  if (size == 0) {
+    return matches;
+  }
+  PRECICE_ASSERT(not _mesh->vertices().empty(), _mesh->getName());
+
+  // The tree has to be loaded before the concurrent queries as loading modifies the cache
+  loadVertexTree();
+  const auto &tree     = *_pimpl->indices.vertexRTree;
+  const auto &vertices = _mesh->vertices();
+  const int   dims     = locations.rows();
+
+  utils::Threading::parallelFor(size, [&](std::size_t begin, std::size_t end) {
+    mesh::Vertex::RawCoords location{0.0, 0.0, 0.0};
+    for (std::size_t i = begin; i < end; ++i) {
+      for (int d = 0; d < dims; ++d) {
+        location[d] = locations(d, i);
+      }
+      tree.query(bgi::nearest(location, 1), boost::make_function_output_iterator([&](size_t matchID) {
+                   matches[i] = VertexMatch(bg::distance(location, vertices[matchID]), matchID);
+                 }));
+    }
+  });
+  return matches;
+}
+
 std::vector<EdgeMatch> Index::getClosestEdges(const Eigen::VectorXd &sourceCoord, int n)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.edgeRTree) {
-    precice::utils::Event e("query.index.getEdgeIndexTree." + _mesh->getName());
-    _pimpl->indices.edgeRTree = impl::Indexer::instance()->getEdgeRTree(_mesh);
-  }
+  loadEdgeTree();
 
   std::vector<EdgeMatch> matches;
   _pimpl->indices.edgeRTree->query(bgi::nearest(sourceCoord, n), boost::make_function_output_iterator([&](size_t matchID) {
@@ -67,11 +119,7 @@ std::vector<EdgeMatch> Index::getClosestEdges(const Eigen::VectorXd &sourceCoord
 std::vector<TriangleMatch> Index::getClosestTriangles(const Eigen::VectorXd &sourceCoord, int n)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.triangleRTree) {
-    precice::utils::Event e("query.index.getTriangleIndexTree." + _mesh->getName());
-    _pimpl->indices.triangleRTree = impl::Indexer::instance()->getTriangleRTree(_mesh);
-  }
+  loadTriangleTree();
 
   std::vector<TriangleMatch> matches;
   _pimpl->indices.triangleRTree->query(bgi::nearest(sourceCoord, n),
@@ -85,11 +133,7 @@ std::vector<TriangleMatch> Index::getClosestTriangles(const Eigen::VectorXd &sou
 std::vector<VertexID> Index::getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (_pimpl->indices.vertexRTree == nullptr) {
-    precice::utils::Event e("query.index.getVertexIndexTree." + _mesh->getName());
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-  }
+  loadVertexTree();
 
   // Prepare boost::geometry box
   auto coords    = centerVertex.getCoords();
@@ -104,11 +148,7 @@ std::vector<VertexID> Index::getVerticesInsideBox(const mesh::Vertex &centerVert
 std::vector<VertexID> Index::getVerticesInsideBox(const mesh::BoundingBox &bb)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.vertexRTree) {
-    precice::utils::Event e("query.index.getVertexIndexTree." + _mesh->getName());
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-  }
+  loadVertexTree();
   std::vector<VertexID> matches;
   _pimpl->indices.vertexRTree->query(bgi::intersects(query::makeBox(bb.minCorner(), bb.maxCorner())), std::back_inserter(matches));
   return matches;
@@ -123,6 +163,38 @@ ProjectionMatch Index::findNearestProjection(const Eigen::VectorXd &location, in
   }
 }
 
+std::vector<ProjectionMatch> Index::findNearestProjections(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n)
+{
+  PRECICE_TRACE(locations.cols(), n);
+  PRECICE_ASSERT(locations.rows() == _mesh->getDimensions(), locations.rows(), _mesh->getDimensions());
+  const std::size_t size = locations.cols();
+  if (size == 0) {
+    return {};
+  }
+
+  // All trees a projection may fall back to have to be loaded before the concurrent queries
+  loadVertexTree();
+  loadEdgeTree();
+  if (_mesh->getDimensions() == 3) {
+    loadTriangleTree();
+  }
+
+  // ProjectionMatch is not default constructible
+  std::vector<boost::optional<ProjectionMatch>> results(size);
+  utils::Threading::parallelFor(size, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      results[i] = findNearestProjection(locations.col(i), n);
+    }
+  });
+
+  std::vector<ProjectionMatch> matches;
+  matches.reserve(size);
+  for (auto &result : results) {
+    matches.push_back(std::move(*result));
+  }
+  return matches;
+}
+
 ProjectionMatch Index::findVertexProjection(const Eigen::VectorXd &location)
 {
   auto match = getClosestVertex(location);
@@ -171,5 +243,15 @@ void clearCache(mesh::Mesh &mesh)
   impl::Indexer::instance()->clearCache(mesh.getID());
 }
 
+void updateCache(mesh::Mesh &mesh)
+{
+  impl::Indexer::instance()->updateCache(mesh);
+}
+
+void releaseCache(MeshID meshID)
+{
+  impl::Indexer::instance()->releaseCache(meshID);
+}
+
 } // namespace query
 } // namespace precice
@@ -61,6 +61,16 @@ public:
   /// Get n number of closest vertices to the given vertex
   VertexMatch getClosestVertex(const Eigen::VectorXd &sourceCoord);
 
+  /**
+   * @brief Get the closest vertex for each of the given locations.
+   *
+   * The locations are the columns of a matrix with one row per mesh dimension.
+   * The queries run concurrently using utils::Threading.
+   *
+   * @returns a match per location in the order of the columns
+   */
+  std::vector<VertexMatch> getClosestVertices(const Eigen::Ref<const Eigen::MatrixXd> &locations);
+
   /// Get n number of closest edges to the given vertex
   std::vector<EdgeMatch> getClosestEdges(const Eigen::VectorXd &sourceCoord, int n);
 
@@ -85,6 +95,16 @@ public:
   */
   ProjectionMatch findNearestProjection(const Eigen::VectorXd &location, int n);
 
+  /**
+   * @brief Find the closest interpolation element for each of the given locations.
+   *
+   * Batched version of findNearestProjection, the locations are the columns of the matrix.
+   * The queries run concurrently using utils::Threading.
+   *
+   * @returns a projection match per location in the order of the columns
+   */
+  std::vector<ProjectionMatch> findNearestProjections(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n);
+
 private:
   struct IndexImpl;
   std::unique_ptr<IndexImpl> _pimpl;
@@ -92,6 +112,11 @@ private:
   const mesh::PtrMesh             _mesh;
   static precice::logging::Logger _log;
 
+  /// Loads the trees required by the batched queries before these run concurrently
+  void loadVertexTree();
+  void loadEdgeTree();
+  void loadTriangleTree();
+
   /// Closest vertex projection element is always the nearest neighbor
   ProjectionMatch findVertexProjection(const Eigen::VectorXd &location);
 
@@ -111,5 +136,11 @@ void clearCache(MeshID meshID);
 /// Clear the cache of given mesh
 void clearCache(mesh::Mesh &mesh);
 
+/// Update the cache of the given mesh after it changed, see impl::Indexer::updateCache()
+void updateCache(mesh::Mesh &mesh);
+
+/// Clear the cache of the given mesh, unless the cache is persistent
+void releaseCache(MeshID meshID);
+
 } // namespace query
 } // namespace precice
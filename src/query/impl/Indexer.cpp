@@ -1,57 +1,78 @@
 #include <boost/range/irange.hpp>
 
 #include "Indexer.hpp"
+#include "logging/LogMacros.hpp"
 #include "mesh/BoundingBox.hpp"
 #include "precice/types.hpp"
+#include "utils/Event.hpp"
 
 namespace precice {
 namespace query {
 namespace impl {
 
+logging::Logger Indexer::_log{"query::impl::Indexer"};
+
+Indexer::VertexIndex::VertexIndex(VertexCoordinates coords, std::size_t capacity)
+    : coordinates(std::move(coords)),
+      // Passing the whole range to the ctor bulk loads the tree using the packing algorithm,
+      // which is about 10x faster than calling tree.insert repeatedly.
+      tree(boost::irange<std::size_t>(0lu, coordinates.size()), RTreeParameters(capacity), VertexTraits::IndexGetter(coordinates))
+{
+}
+
 std::shared_ptr<Indexer> Indexer::instance()
 {
   static std::shared_ptr<Indexer> indexer{new Indexer};
   return indexer;
 }
 
-MeshIndices &Indexer::cacheEntry(MeshID meshID)
+Indexer::CacheEntry &Indexer::cacheEntry(MeshID meshID)
 {
-  auto result = _cachedTrees.emplace(std::make_pair(meshID, MeshIndices{}));
+  auto result = _cachedTrees.emplace(std::make_pair(meshID, CacheEntry{}));
   return result.first->second;
 }
 
 VertexTraits::Ptr Indexer::getVertexRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
-  if (cache.vertexRTree) {
-    return cache.vertexRTree;
+  auto &entry = cacheEntry(mesh->getID());
+  if (entry.indices.vertexRTree) {
+    if (entry.vertexRevision == mesh->getVertexRevision()) {
+      return entry.indices.vertexRTree;
+    }
+    // Vertices were changed without signaling meshChanged, e.g., by Vertex::setCoords()
+    updateCache(*mesh);
+    return getVertexRTree(mesh);
   }
 
   // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters     params;
-  VertexTraits::IndexGetter ind(mesh->vertices());
-  auto                      tree = std::make_shared<VertexTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh->vertices().size()), params, ind);
-
-  cache.vertexRTree = std::move(tree);
-  return cache.vertexRTree;
+  // the best we can do.
+  VertexCoordinates coords;
+  coords.reserve(mesh->vertices().size());
+  for (const auto &vertex : mesh->vertices()) {
+    coords.push_back(vertex.rawCoords());
+  }
+  entry.vertexIndex = std::make_shared<VertexIndex>(std::move(coords), _nodeCapacity);
+  entry.vertexRevision = mesh->getVertexRevision();
+
+  // The returned tree shares the ownership of the indexed coordinates
+  entry.indices.vertexRTree = VertexTraits::Ptr(entry.vertexIndex, &entry.vertexIndex->tree);
+  return entry.indices.vertexRTree;
 }
 
 EdgeTraits::Ptr Indexer::getEdgeRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
+  auto &cache = cacheEntry(mesh->getID()).indices;
   if (cache.edgeRTree) {
     return cache.edgeRTree;
   }
 
   // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters   params;
+  // the best we can do. The range constructor bulk loads the tree using the
+  // packing algorithm, which is about 10x faster than calling tree->insert
+  // repeatedly and results in a better balanced tree.
+  impl::RTreeParameters   params(_nodeCapacity);
   EdgeTraits::IndexGetter ind(mesh->edges());
   auto                    tree = std::make_shared<EdgeTraits::RTree>(
       boost::irange<std::size_t>(0lu, mesh->edges().size()), params, ind);
@@ -63,7 +84,7 @@ EdgeTraits::Ptr Indexer::getEdgeRTree(const mesh::PtrMesh &mesh)
 TriangleTraits::Ptr Indexer::getTriangleRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
+  auto &cache = cacheEntry(mesh->getID()).indices;
   if (cache.triangleRTree) {
     return cache.triangleRTree;
   }
@@ -79,8 +100,8 @@ TriangleTraits::Ptr Indexer::getTriangleRTree(const mesh::PtrMesh &mesh)
   }
 
   // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do.
-  impl::RTreeParameters       params;
+  // the best we can do. This bulk loads the tree using the packing algorithm.
+  impl::RTreeParameters       params(_nodeCapacity);
   TriangleTraits::IndexGetter ind;
   auto                        tree = std::make_shared<TriangleTraits::RTree>(elements, params, ind);
   cache.triangleRTree              = std::move(tree);
@@ -92,6 +113,17 @@ size_t Indexer::getCacheSize()
   return _cachedTrees.size();
 }
 
+void Indexer::setNodeCapacity(std::size_t capacity)
+{
+  PRECICE_ASSERT(capacity >= 4, capacity);
+  _nodeCapacity = capacity;
+}
+
+std::size_t Indexer::getNodeCapacity() const
+{
+  return _nodeCapacity;
+}
+
 void Indexer::clearCache()
 {
   _cachedTrees.clear();
@@ -102,6 +134,96 @@ void Indexer::clearCache(MeshID meshID)
   _cachedTrees.erase(meshID);
 }
 
+void Indexer::updateCache(const mesh::Mesh &mesh)
+{
+  if (not _persistentCache) {
+    clearCache(mesh.getID());
+    return;
+  }
+
+  auto pos = _cachedTrees.find(mesh.getID());
+  if (pos == _cachedTrees.end()) {
+    return;
+  }
+  auto &      entry    = pos->second;
+  const auto &vertices = mesh.vertices();
+
+  // Without a vertex tree, we cannot detect moved vertices
+  bool verticesChanged = true;
+  if (entry.vertexIndex && entry.vertexRevision == mesh.getVertexRevision()) {
+    verticesChanged = false;
+  } else if (entry.vertexIndex) {
+    auto &coords = entry.vertexIndex->coordinates;
+    if (vertices.size() < coords.size()) {
+      PRECICE_DEBUG("Vertices of mesh \"{}\" were removed, clearing the cache", mesh.getName());
+      _cachedTrees.erase(pos);
+      return;
+    }
+
+    std::vector<VertexID> moved;
+    for (std::size_t i = 0; i < coords.size(); ++i) {
+      if (vertices[i].rawCoords() != coords[i]) {
+        moved.push_back(i);
+      }
+    }
+    const std::size_t appended = vertices.size() - coords.size();
+    const std::size_t changes  = moved.size() + appended;
+    verticesChanged            = changes > 0;
+
+    if (changes > _rebuildFraction * vertices.size()) {
+      PRECICE_DEBUG("{} of {} vertices of mesh \"{}\" changed, rebuilding the vertex tree", changes, vertices.size(), mesh.getName());
+      entry.indices.vertexRTree.reset();
+      entry.vertexIndex.reset();
+    } else if (verticesChanged) {
+      PRECICE_DEBUG("{} of {} vertices of mesh \"{}\" changed, updating the vertex tree", changes, vertices.size(), mesh.getName());
+      precice::utils::Event e("query.index.updateVertexIndexTree." + mesh.getName());
+      auto &                tree = entry.vertexIndex->tree;
+      // Removing a vertex requires its previous coordinates
+      for (auto i : moved) {
+        tree.remove(i);
+        coords[i] = vertices[i].rawCoords();
+        tree.insert(i);
+      }
+      for (std::size_t i = coords.size(); i < vertices.size(); ++i) {
+        coords.push_back(vertices[i].rawCoords());
+        tree.insert(i);
+      }
+    }
+    entry.vertexRevision = mesh.getVertexRevision();
+  }
+
+  // Edges and triangles depend on the vertex coordinates
+  if (verticesChanged || (entry.indices.edgeRTree && entry.indices.edgeRTree->size() != mesh.edges().size())) {
+    entry.indices.edgeRTree.reset();
+  }
+  if (verticesChanged || (entry.indices.triangleRTree && entry.indices.triangleRTree->size() != mesh.triangles().size())) {
+    entry.indices.triangleRTree.reset();
+  }
+
+  if (not entry.indices.vertexRTree && not entry.indices.edgeRTree && not entry.indices.triangleRTree) {
+    _cachedTrees.erase(pos);
+  }
+}
+
+void Indexer::releaseCache(MeshID meshID)
+{
+  if (not _persistentCache) {
+    clearCache(meshID);
+  }
+}
+
+void Indexer::setPersistentCache(bool persistent, double rebuildFraction)
+{
+  PRECICE_ASSERT(rebuildFraction >= 0.0 && rebuildFraction <= 1.0, rebuildFraction);
+  _persistentCache = persistent;
+  _rebuildFraction = rebuildFraction;
+}
+
+bool Indexer::isPersistentCache() const
+{
+  return _persistentCache;
+}
+
 } // namespace impl
 } // namespace query
 } // namespace precice
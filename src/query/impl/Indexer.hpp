@@ -1,7 +1,10 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <vector>
 
+#include "logging/Logger.hpp"
 #include "precice/types.hpp"
 #include "query/impl/RTreeAdapter.hpp"
 
@@ -9,7 +12,21 @@ namespace precice {
 namespace query {
 namespace impl {
 
-using VertexTraits   = impl::RTreeTraits<mesh::Vertex>;
+/// Copy of the vertex coordinates indexed by the vertex tree
+using VertexCoordinates = std::vector<mesh::Vertex::RawCoords>;
+
+/**
+ * @brief The vertex tree indexes a copy of the vertex coordinates instead of the mesh vertices.
+ *
+ * This allows to move single vertices in the tree, as removing a vertex requires its previous coordinates.
+ */
+struct VertexTraits {
+  using IndexType   = VertexCoordinates::size_type;
+  using IndexGetter = impl::VectorIndexable<VertexCoordinates>;
+  using RTree       = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
+  using Ptr         = std::shared_ptr<RTree>;
+};
+
 using EdgeTraits     = impl::RTreeTraits<mesh::Edge>;
 using TriangleTraits = impl::RTreeTraits<mesh::Triangle>;
 
@@ -38,16 +55,77 @@ public:
 
   size_t getCacheSize();
 
+  /**
+   * @brief Sets the maximal number of elements per node of the trees.
+   *
+   * Only trees built afterwards use the new capacity, cached trees are kept.
+   * Larger nodes result in shallower trees which are faster to build but slower to query.
+   */
+  void setNodeCapacity(std::size_t capacity);
+
+  /// Returns the maximal number of elements per node of the trees
+  std::size_t getNodeCapacity() const;
+
   /// Clear the whole cache
   void clearCache();
 
   /// Clear the cache only for the given mesh
   void clearCache(MeshID meshID);
 
+  /**
+   * @brief Updates the cache of the given mesh after it changed.
+   *
+   * Without a persistent cache, this clears the cache of the mesh.
+   * Otherwise, moved and appended vertices are updated in the cached vertex tree,
+   * unless their fraction of all vertices exceeds the rebuild fraction.
+   * Cached edge and triangle trees are only kept if no vertex changed.
+   */
+  void updateCache(const mesh::Mesh &mesh);
+
+  /// Clears the cache of the given mesh, unless the cache is persistent
+  void releaseCache(MeshID meshID);
+
+  /**
+   * @brief Configures whether trees are kept and updated over mesh changes.
+   *
+   * @param[in] persistent keep the trees when mappings are cleared and update them on mesh changes
+   * @param[in] rebuildFraction fraction of changed vertices above which the vertex tree is rebuilt from scratch
+   */
+  void setPersistentCache(bool persistent, double rebuildFraction);
+
+  /// Returns whether the trees are kept and updated over mesh changes
+  bool isPersistentCache() const;
+
 private:
+  /// The vertex tree together with the coordinates it indexes
+  struct VertexIndex {
+    VertexIndex(VertexCoordinates coords, std::size_t capacity);
+    VertexIndex(const VertexIndex &) = delete;
+    VertexIndex &operator=(const VertexIndex &) = delete;
+
+    VertexCoordinates   coordinates;
+    VertexTraits::RTree tree;
+  };
+
+  struct CacheEntry {
+    MeshIndices indices;
+    /// Owns the vertex tree of indices, which is an aliasing pointer into it
+    std::shared_ptr<VertexIndex> vertexIndex;
+    /// Vertex revision of the mesh the vertex tree corresponds to
+    std::size_t vertexRevision = 0;
+  };
+
   Indexer(){};
-  MeshIndices &              cacheEntry(MeshID meshID);
-  std::map<int, MeshIndices> _cachedTrees;
+  CacheEntry &              cacheEntry(MeshID meshID);
+  std::map<int, CacheEntry> _cachedTrees;
+
+  std::size_t _nodeCapacity = DEFAULT_RTREE_NODE_CAPACITY;
+
+  bool _persistentCache = false;
+
+  double _rebuildFraction = 0.1;
+
+  static logging::Logger _log;
 };
 
 } // namespace impl
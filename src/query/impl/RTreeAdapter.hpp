@@ -220,8 +220,11 @@ inline RTreeBox makeBox(const Eigen::VectorXd &min, const Eigen::VectorXd &max)
 
 namespace impl {
 
-/// The general rtree parameter type used in precice
-using RTreeParameters = boost::geometry::index::rstar<16>;
+/// The general rtree parameter type used in precice, the node capacity is chosen at runtime
+using RTreeParameters = boost::geometry::index::dynamic_rstar;
+
+/// The default maximal number of elements per node of the rtrees
+constexpr std::size_t DEFAULT_RTREE_NODE_CAPACITY{16};
 
 /// Type trait to extract information based on the type of a Primitive
 template <class T>
@@ -1,5 +1,7 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -19,6 +21,7 @@
 #include "query/impl/Indexer.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/Threading.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -89,6 +92,101 @@ PtrMesh vertexMesh3D()
   mesh->computeBoundingBox();
   return mesh;
 }
+
+/// Creates a triangulated n x n grid on a slightly curved surface, hence with 2 n^2 triangles
+PtrMesh triangulatedSurface(int n)
+{
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+  for (int i = 0; i <= n; ++i) {
+    for (int j = 0; j <= n; ++j) {
+      const double x = static_cast<double>(i) / n;
+      const double y = static_cast<double>(j) / n;
+      mesh->createVertex(Eigen::Vector3d(x, y, 0.1 * x * y));
+    }
+  }
+  auto vertex = [&](int i, int j) -> precice::mesh::Vertex & { return mesh->vertices()[i * (n + 1) + j]; };
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      auto &v00 = vertex(i, j);
+      auto &v01 = vertex(i, j + 1);
+      auto &v10 = vertex(i + 1, j);
+      auto &v11 = vertex(i + 1, j + 1);
+      auto &e1  = mesh->createUniqueEdge(v00, v01);
+      auto &e2  = mesh->createUniqueEdge(v01, v11);
+      auto &e3  = mesh->createUniqueEdge(v11, v10);
+      auto &e4  = mesh->createUniqueEdge(v10, v00);
+      auto &ed  = mesh->createEdge(v00, v11);
+      mesh->createTriangle(e1, e2, ed);
+      mesh->createTriangle(e3, e4, ed);
+    }
+  }
+  return mesh;
+}
+
+/// Reports build and query times of the vertex and triangle trees for meshes with about the given number of primitives
+void benchmarkRTrees(std::size_t primitives, std::size_t capacity)
+{
+  using Clock       = std::chrono::steady_clock;
+  auto seconds      = [](Clock::time_point start) { return std::chrono::duration<double>(Clock::now() - start).count(); };
+  auto indexer      = impl::Indexer::instance();
+  auto prevCapacity = indexer->getNodeCapacity();
+  indexer->setNodeCapacity(capacity);
+
+  {
+    const int n = std::max(2, static_cast<int>(std::round(std::cbrt(primitives))));
+    PtrMesh   mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        for (int k = 0; k < n; ++k) {
+          mesh->createVertex(Eigen::Vector3d(k, j, i));
+        }
+      }
+    }
+    Eigen::MatrixXd locations = mesh->vertexCoordinates();
+    locations.array() += 0.1;
+
+    auto start = Clock::now();
+    auto tree  = indexer->getVertexRTree(mesh);
+    auto build = seconds(start);
+
+    Index index(mesh);
+    start           = Clock::now();
+    auto matches    = index.getClosestVertices(locations);
+    auto query      = seconds(start);
+    bool allMatched = true;
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+      allMatched &= matches[i].index == static_cast<int>(i);
+    }
+    BOOST_TEST(allMatched);
+    BOOST_TEST_MESSAGE("Vertex tree with " << mesh->vertices().size() << " vertices and capacity " << capacity
+                                           << ": build " << build << "s, " << matches.size() << " queries " << query << "s");
+    query::clearCache(*mesh);
+  }
+
+  {
+    const int n    = std::max(1, static_cast<int>(std::round(std::sqrt(primitives / 2.0))));
+    auto      mesh = triangulatedSurface(n);
+
+    auto start = Clock::now();
+    auto tree  = indexer->getTriangleRTree(mesh);
+    auto build = seconds(start);
+
+    Index index(mesh);
+    start         = Clock::now();
+    auto matches  = index.findNearestProjections(mesh->vertexCoordinates(), 4);
+    auto query    = seconds(start);
+    bool allFound = matches.size() == mesh->vertices().size();
+    for (const auto &match : matches) {
+      allFound &= match.distance < 1e-12;
+    }
+    BOOST_TEST(allFound);
+    BOOST_TEST_MESSAGE("Triangle tree with " << mesh->triangles().size() << " triangles and capacity " << capacity
+                                             << ": build " << build << "s, " << matches.size() << " projections " << query << "s");
+    query::clearCache(*mesh);
+  }
+
+  indexer->setNodeCapacity(prevCapacity);
+}
 } // namespace
 
 BOOST_AUTO_TEST_SUITE(QueryTests)
@@ -200,6 +298,81 @@ BOOST_AUTO_TEST_CASE(QueryWithBoxEverything)
   BOOST_TEST(results.size() == 8);
 }
 
+/// Resembles how the vertex index is used in SolverInterfaceImpl::getMeshVertexIDsFromPositions
+BOOST_AUTO_TEST_CASE(QueryIDsFromPositionsLarge)
+{
+  PRECICE_TEST(1_rank);
+  constexpr int n = 47; // 47^3 = 103823 vertices
+  PtrMesh       mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        mesh->createVertex(Eigen::Vector3d(0.1 * k, 0.2 * j, 0.3 * i));
+      }
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  Index      indexTree(mesh);
+  bool       allMatched = true;
+  for (const auto &vertex : mesh->vertices()) {
+    auto match = indexTree.getClosestVertex(vertex.getCoords());
+    allMatched &= (match.index == vertex.getID()) && (match.distance == 0.0);
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  BOOST_TEST(allMatched);
+  BOOST_TEST_MESSAGE("Looked up " << mesh->vertices().size() << " positions in "
+                                  << std::chrono::duration<double>(stop - start).count() << "s");
+}
+
+BOOST_AUTO_TEST_CASE(QueryClosestVerticesBatched)
+{
+  PRECICE_TEST(1_rank);
+  constexpr int n = 20;
+  PtrMesh       mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        mesh->createVertex(Eigen::Vector3d(0.1 * k, 0.2 * j, 0.3 * i));
+      }
+    }
+  }
+  // Shift the locations slightly, which keeps the closest vertex unique
+  Eigen::MatrixXd locations = mesh->vertexCoordinates();
+  locations.array() += 0.01;
+
+  const int previousThreads = precice::utils::Threading::getNumberOfThreads();
+  for (int threads : {1, 4}) {
+    precice::utils::Threading::setNumberOfThreads(threads);
+    Index      indexTree(mesh);
+    const auto matches = indexTree.getClosestVertices(locations);
+    BOOST_TEST_REQUIRE(matches.size() == mesh->vertices().size());
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+      const auto single = indexTree.getClosestVertex(locations.col(i));
+      BOOST_TEST(matches[i].index == static_cast<int>(i));
+      BOOST_TEST(matches[i].index == single.index);
+      BOOST_TEST(matches[i].distance == single.distance);
+    }
+  }
+  precice::utils::Threading::setNumberOfThreads(previousThreads);
+}
+
+BOOST_AUTO_TEST_CASE(QueryClosestVerticesBatched2D)
+{
+  PRECICE_TEST(1_rank);
+  auto            mesh = edgeMesh2D();
+  Index           indexTree(mesh);
+  Eigen::MatrixXd locations(2, 2);
+  locations << 0.2, 0.9,
+      0.8, 0.1;
+
+  const auto matches = indexTree.getClosestVertices(locations);
+  BOOST_TEST_REQUIRE(matches.size() == 2);
+  BOOST_TEST(matches[0].index == 1);
+  BOOST_TEST(matches[1].index == 2);
+  BOOST_TEST(matches[1].distance == std::sqrt(0.02), boost::test_tools::tolerance(1e-12));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Vertex
 
 BOOST_AUTO_TEST_SUITE(Edge)
@@ -401,6 +574,65 @@ BOOST_AUTO_TEST_CASE(CacheAll)
   BOOST_TEST(tt1 == tt2);
 }
 
+BOOST_AUTO_TEST_CASE(PersistentUpdate)
+{
+  PRECICE_TEST(1_rank);
+  auto indexer = impl::Indexer::instance();
+  BOOST_TEST(not indexer->isPersistentCache());
+  indexer->setPersistentCache(true, 0.3);
+
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, precice::testing::nextMeshID()));
+  for (int i = 0; i < 10; ++i) {
+    mesh->createVertex(Eigen::Vector2d(i, 0));
+  }
+  auto vt1 = indexer->getVertexRTree(mesh);
+  auto et1 = indexer->getEdgeRTree(mesh);
+
+  // Releasing keeps the persistent trees
+  query::releaseCache(mesh->getID());
+  BOOST_TEST(indexer->getCacheSize() == 1);
+  BOOST_TEST(indexer->getVertexRTree(mesh) == vt1);
+
+  // Signaling an unchanged mesh keeps all trees
+  mesh->meshChanged(*mesh);
+  BOOST_TEST(indexer->getVertexRTree(mesh) == vt1);
+  BOOST_TEST(indexer->getEdgeRTree(mesh) == et1);
+
+  // Moving and appending a few vertices updates the vertex tree
+  mesh->vertices()[3].setCoords(Eigen::Vector2d(3, 5));
+  mesh->createVertex(Eigen::Vector2d(20, 0));
+  mesh->meshChanged(*mesh);
+  auto vt2 = indexer->getVertexRTree(mesh);
+  BOOST_TEST(vt2 == vt1);
+  BOOST_TEST(vt2->size() == 11);
+  BOOST_TEST(indexer->getEdgeRTree(mesh) != et1);
+
+  Index index(mesh);
+  BOOST_TEST(index.getClosestVertex(Eigen::Vector2d(3, 4.9)).index == 3);
+  BOOST_TEST(index.getClosestVertex(Eigen::Vector2d(3, 0.1)).index != 3);
+  BOOST_TEST(index.getClosestVertex(Eigen::Vector2d(19, 0)).index == 10);
+
+  // Moving more vertices than the rebuild fraction rebuilds the vertex tree
+  for (int i = 0; i < 5; ++i) {
+    mesh->vertices()[i].setCoords(Eigen::Vector2d(i, -1));
+  }
+  mesh->meshChanged(*mesh);
+  auto vt3 = indexer->getVertexRTree(mesh);
+  BOOST_TEST(vt3 != vt1);
+  BOOST_TEST(vt3->size() == 11);
+
+  // Moving a vertex without signaling the change updates the vertex tree on the next query
+  mesh->vertices()[7].setCoords(Eigen::Vector2d(7, 5));
+  BOOST_TEST(indexer->getVertexRTree(mesh) == vt3);
+  BOOST_TEST(Index(mesh).getClosestVertex(Eigen::Vector2d(7, 4.9)).index == 7);
+
+  // Clearing the mesh clears the cache
+  mesh->clear();
+  BOOST_TEST(indexer->getCacheSize() == 0);
+
+  indexer->setPersistentCache(false, 0.1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Cache
 
 BOOST_AUTO_TEST_SUITE(Projection)
@@ -471,7 +703,78 @@ BOOST_AUTO_TEST_CASE(ProjectionToTriangle)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ProjectionBatched)
+{
+  PRECICE_TEST(1_rank);
+  auto  meshPtr = fullMesh();
+  Index indexTree(meshPtr);
+
+  // Locations projecting to a vertex, an edge, and a triangle
+  Eigen::MatrixXd locations(3, 3);
+  locations.col(0) = Eigen::Vector3d(4.0, 0.0, 0.0);
+  locations.col(1) = Eigen::Vector3d(2.0, -1.0, 0.0);
+  locations.col(2) = Eigen::Vector3d(1.0, 1.0, 0.1);
+
+  const int previousThreads = precice::utils::Threading::getNumberOfThreads();
+  precice::utils::Threading::setNumberOfThreads(3);
+  const auto matches = indexTree.findNearestProjections(locations, 1);
+  precice::utils::Threading::setNumberOfThreads(previousThreads);
+
+  BOOST_TEST_REQUIRE(matches.size() == 3);
+  for (int i = 0; i < 3; ++i) {
+    const auto  single   = indexTree.findNearestProjection(locations.col(i), 1);
+    const auto &elements = matches[i].polation.getWeightedElements();
+    BOOST_TEST(elements.size() == static_cast<std::size_t>(i + 1));
+    BOOST_TEST(matches[i].distance == single.distance);
+    BOOST_TEST_REQUIRE(elements.size() == single.polation.getWeightedElements().size());
+    for (std::size_t e = 0; e < elements.size(); ++e) {
+      BOOST_TEST(elements[e].vertexID == single.polation.getWeightedElements()[e].vertexID);
+      BOOST_TEST(elements[e].weight == single.polation.getWeightedElements()[e].weight);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Projection
 
+BOOST_AUTO_TEST_SUITE(Benchmark)
+
+BOOST_AUTO_TEST_CASE(NodeCapacity)
+{
+  PRECICE_TEST(1_rank);
+  auto indexer  = impl::Indexer::instance();
+  auto previous = indexer->getNodeCapacity();
+  BOOST_TEST(previous == impl::DEFAULT_RTREE_NODE_CAPACITY);
+
+  indexer->setNodeCapacity(32);
+  auto mesh = fullMesh();
+  auto tree = indexer->getVertexRTree(mesh);
+  BOOST_TEST(tree->parameters().get_max_elements() == 32);
+  BOOST_TEST(tree->size() == mesh->vertices().size());
+
+  indexer->setNodeCapacity(previous);
+  query::clearCache(*mesh);
+}
+
+BOOST_AUTO_TEST_CASE(BuildAndQuery)
+{
+  PRECICE_TEST(1_rank);
+  for (std::size_t capacity : {8, 16, 32}) {
+    benchmarkRTrees(10000, capacity);
+  }
+}
+
+/// Run with PRECICE_BENCHMARKS set and --run_test=QueryTests/MeshTests/Benchmark/BuildAndQueryLarge
+BOOST_AUTO_TEST_CASE(BuildAndQueryLarge, *boost::unit_test::precondition(testing::benchmarksEnabled))
+{
+  PRECICE_TEST(1_rank);
+  for (std::size_t primitives : {100000, 1000000, 10000000}) {
+    for (std::size_t capacity : {8, 16, 32, 64}) {
+      benchmarkRTrees(primitives, capacity);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Benchmark
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Query
@@ -64,6 +64,8 @@ target_sources(precice
     src/com/CommunicationFactory.hpp
     src/com/ConnectionInfoPublisher.cpp
     src/com/ConnectionInfoPublisher.hpp
+    src/com/DeferredRequest.cpp
+    src/com/DeferredRequest.hpp
     src/com/MPICommunication.cpp
     src/com/MPICommunication.hpp
     src/com/MPIDirectCommunication.cpp
@@ -80,6 +82,14 @@ target_sources(precice
     src/com/MPISinglePortsCommunicationFactory.hpp
     src/com/Request.cpp
     src/com/Request.hpp
+    src/com/SharedMemoryCommunication.cpp
+    src/com/SharedMemoryCommunication.hpp
+    src/com/SharedMemoryCommunicationFactory.cpp
+    src/com/SharedMemoryCommunicationFactory.hpp
+    src/com/SharedMemoryLink.cpp
+    src/com/SharedMemoryLink.hpp
+    src/com/SharedMemoryRequest.cpp
+    src/com/SharedMemoryRequest.hpp
     src/com/SharedPointer.hpp
     src/com/SocketCommunication.cpp
     src/com/SocketCommunication.hpp
@@ -124,6 +134,10 @@ target_sources(precice
     src/cplscheme/impl/ResidualRelativeConvergenceMeasure.cpp
     src/cplscheme/impl/ResidualRelativeConvergenceMeasure.hpp
     src/cplscheme/impl/SharedPointer.hpp
+    src/io/BinaryReader.cpp
+    src/io/BinaryReader.hpp
+    src/io/BinaryWriter.cpp
+    src/io/BinaryWriter.hpp
     src/io/Export.hpp
     src/io/ExportCSV.cpp
     src/io/ExportCSV.hpp
@@ -156,7 +170,10 @@ target_sources(precice
     src/logging/config/LogConfiguration.hpp
     src/m2n/BoundM2N.cpp
     src/m2n/BoundM2N.hpp
+    src/m2n/Compression.cpp
+    src/m2n/Compression.hpp
     src/m2n/DistributedComFactory.hpp
+    src/m2n/DistributedCommunication.cpp
     src/m2n/DistributedCommunication.hpp
     src/m2n/GatherScatterComFactory.cpp
     src/m2n/GatherScatterComFactory.hpp
@@ -181,6 +198,7 @@ target_sources(precice
     src/mapping/NearestNeighborGradientMapping.hpp
     src/mapping/NearestProjectionMapping.cpp
     src/mapping/NearestProjectionMapping.hpp
+    src/mapping/PartitionOfUnityMapping.hpp
     src/mapping/PetRadialBasisFctMapping.hpp
     src/mapping/Polation.cpp
     src/mapping/Polation.hpp
@@ -189,6 +207,11 @@ target_sources(precice
     src/mapping/config/MappingConfiguration.cpp
     src/mapping/config/MappingConfiguration.hpp
     src/mapping/impl/BasisFunctions.hpp
+    src/mapping/impl/PartitionOfUnity.cpp
+    src/mapping/impl/PartitionOfUnity.hpp
+    src/mapping/impl/SchurRBFSolver.hpp
+    src/mapping/impl/SparseOperator.cpp
+    src/mapping/impl/SparseOperator.hpp
     src/math/barycenter.cpp
     src/math/barycenter.hpp
     src/math/constants.hpp
@@ -289,6 +312,8 @@ target_sources(precice
     src/utils/String.hpp
     src/utils/TableWriter.cpp
     src/utils/TableWriter.hpp
+    src/utils/Threading.cpp
+    src/utils/Threading.hpp
     src/utils/TypeNames.hpp
     src/utils/algorithm.hpp
     src/utils/assertion.hpp
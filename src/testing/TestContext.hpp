@@ -131,6 +131,11 @@ struct ConnectionOptions {
    */
   bool useTwoLevelInit = false;
 
+  /** Wheather to exchange all data of a mesh in a single message
+   * @see M2N::M2N()
+   */
+  bool usePackedExchange = false;
+
   /** The type of \ref DistributedCommunication to create
    * @see M2N::M2N()Q
    */
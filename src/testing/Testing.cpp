@@ -46,5 +46,12 @@ std::string getTestName()
   return boost::unit_test::framework::current_test_case().p_name;
 }
 
+boost::test_tools::assertion_result benchmarksEnabled(bt::test_unit_id)
+{
+  boost::test_tools::assertion_result result(std::getenv("PRECICE_BENCHMARKS") != nullptr);
+  result.message() << "Benchmarks run only if PRECICE_BENCHMARKS is set";
+  return result;
+}
+
 } // namespace testing
 } // namespace precice
@@ -123,6 +123,13 @@ std::string getTestName();
 /// Returns the full path to the file containting the current test.
 std::string getTestPath();
 
+/** Boost.Test precondition of benchmarks, which are too expensive for the regular test runs.
+ *
+ * Use it instead of boost::unit_test::disabled(), as selecting a parent suite with --run_test
+ * enables disabled tests again. Benchmarks run only if $PRECICE_BENCHMARKS is set.
+ */
+boost::test_tools::assertion_result benchmarksEnabled(bt::test_unit_id);
+
 /** Generates a new mesh id for use in tests.
  *
  * @returns a new unique mesh ID
@@ -17,6 +17,7 @@ target_sources(testprecice
     src/com/tests/MPIDirectCommunicationTest.cpp
     src/com/tests/MPIPortsCommunicationTest.cpp
     src/com/tests/MPISinglePortsCommunicationTest.cpp
+    src/com/tests/SharedMemoryCommunicationTest.cpp
     src/com/tests/SocketCommunicationTest.cpp
     src/cplscheme/tests/AbsoluteConvergenceMeasureTest.cpp
     src/cplscheme/tests/CompositionalCouplingSchemeTest.cpp
@@ -29,6 +30,7 @@ target_sources(testprecice
     src/cplscheme/tests/RelativeConvergenceMeasureTest.cpp
     src/cplscheme/tests/ResidualRelativeConvergenceMeasureTest.cpp
     src/cplscheme/tests/SerialImplicitCouplingSchemeTest.cpp
+    src/io/tests/BinaryWriterReaderTest.cpp
     src/io/tests/ExportCSVTest.cpp
     src/io/tests/ExportConfigurationTest.cpp
     src/io/tests/ExportVTKTest.cpp
@@ -36,12 +38,15 @@ target_sources(testprecice
     src/io/tests/ExportVTUTest.cpp
     src/io/tests/TXTTableWriterTest.cpp
     src/io/tests/TXTWriterReaderTest.cpp
+    src/m2n/tests/CompressionTest.cpp
     src/m2n/tests/GatherScatterCommunicationTest.cpp
+    src/m2n/tests/PackedExchangeTest.cpp
     src/m2n/tests/PointToPointCommunicationTest.cpp
     src/mapping/tests/MappingConfigurationTest.cpp
     src/mapping/tests/NearestNeighborMappingTest.cpp
     src/mapping/tests/NearestNeighborGradientMappingTest.cpp
     src/mapping/tests/NearestProjectionMappingTest.cpp
+    src/mapping/tests/PartitionOfUnityMappingTest.cpp
     src/mapping/tests/PetRadialBasisFctMappingTest.cpp
     src/mapping/tests/PolationTest.cpp
     src/mapping/tests/RadialBasisFctMappingTest.cpp
@@ -88,6 +93,7 @@ target_sources(testprecice
     src/utils/tests/PointerVectorTest.cpp
     src/utils/tests/StatisticsTest.cpp
     src/utils/tests/StringTest.cpp
+    src/utils/tests/ThreadingTest.cpp
     src/xml/tests/ParserTest.cpp
     src/xml/tests/PrinterTest.cpp
     src/xml/tests/XMLTest.cpp
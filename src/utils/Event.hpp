@@ -27,7 +27,7 @@ public:
 
   using StateChanges = std::vector<std::pair<State, Clock::time_point>>;
 
-  using Data = std::map<std::string, std::vector<int>>;
+  using Data = std::map<std::string, std::vector<long long>>;
 
   /// An Event can't be copied.
   Event(const Event &other) = delete;
@@ -58,7 +58,7 @@ public:
   Clock::duration getDuration() const;
 
   /// Adds named integer data, associated to an event.
-  void addData(const std::string &key, int value);
+  void addData(const std::string &key, long long value);
 
   Data data;
 
@@ -55,9 +55,9 @@ public:
   Event::StateChanges stateChanges;
 
 private:
-  std::string                             name;
-  long                                    count = 0;
-  std::map<std::string, std::vector<int>> data;
+  std::string name;
+  long        count = 0;
+  Event::Data data;
 };
 
 /// Holds all EventData of one particular rank
@@ -0,0 +1,19 @@
+#include "utils/Threading.hpp"
+
+namespace precice {
+namespace utils {
+
+int Threading::_threads = 1;
+
+void Threading::setNumberOfThreads(int threads)
+{
+  _threads = std::max(threads, 1);
+}
+
+int Threading::getNumberOfThreads()
+{
+  return _threads;
+}
+
+} // namespace utils
+} // namespace precice
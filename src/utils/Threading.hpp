@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Utility class for thread-parallel loops on a single rank.
+ *
+ * The number of threads is configured once per participant.
+ * Using a single thread runs all loops on the calling thread.
+ */
+class Threading {
+public:
+  /// Sets the number of threads used by parallelFor. Values smaller than 1 are treated as 1.
+  static void setNumberOfThreads(int threads);
+
+  /// Returns the number of threads used by parallelFor.
+  static int getNumberOfThreads();
+
+  /**
+   * @brief Executes func(begin, end) for contiguous chunks of the range [0, size).
+   *
+   * The chunks are processed concurrently by up to getNumberOfThreads() threads.
+   * The calling thread processes the first chunk and returns once all chunks are done.
+   * Hence, func has to be safe to call concurrently on disjoint ranges.
+   */
+  template <typename Func>
+  static void parallelFor(std::size_t size, Func &&func);
+
+private:
+  static int _threads;
+};
+
+// --------------------------------------------------------- HEADER DEFINITIONS
+
+template <typename Func>
+void Threading::parallelFor(std::size_t size, Func &&func)
+{
+  const std::size_t chunks = std::min<std::size_t>(getNumberOfThreads(), size);
+  if (chunks <= 1) {
+    func(std::size_t{0}, size);
+    return;
+  }
+
+  const std::size_t        chunkSize = (size + chunks - 1) / chunks;
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  for (std::size_t begin = chunkSize; begin < size; begin += chunkSize) {
+    const std::size_t end = std::min(begin + chunkSize, size);
+    workers.emplace_back([&func, begin, end] { func(begin, end); });
+  }
+  func(std::size_t{0}, chunkSize);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,42 @@
+#include <atomic>
+#include <vector>
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Threading.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(ThreadingTests)
+
+BOOST_AUTO_TEST_CASE(ParallelForCoversRange)
+{
+  PRECICE_TEST(1_rank);
+  const int previous = Threading::getNumberOfThreads();
+  for (int threads : {1, 2, 3, 8}) {
+    Threading::setNumberOfThreads(threads);
+    BOOST_TEST(Threading::getNumberOfThreads() == threads);
+    for (std::size_t size : {0, 1, 5, 100}) {
+      std::vector<int>         visits(size, 0);
+      std::atomic<std::size_t> calls{0};
+      Threading::parallelFor(size, [&](std::size_t begin, std::size_t end) {
+        ++calls;
+        for (std::size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+      });
+      BOOST_TEST(calls.load() >= 1);
+      BOOST_TEST(calls.load() <= static_cast<std::size_t>(threads));
+      for (int v : visits) {
+        BOOST_TEST(v == 1);
+      }
+    }
+  }
+  Threading::setNumberOfThreads(0);
+  BOOST_TEST(Threading::getNumberOfThreads() == 1);
+  Threading::setNumberOfThreads(previous);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Threading
+BOOST_AUTO_TEST_SUITE_END() // Utils